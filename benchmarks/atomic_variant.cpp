@@ -0,0 +1,134 @@
+#include "atomic_variant.hpp"
+#include "variant.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace stct = static_containers;
+
+namespace
+{
+    constexpr size_t LOADS = 1 << 14;
+
+    struct Idle
+    {};
+
+    struct Running
+    {
+        std::uint32_t rate;
+        std::uint32_t limit;
+        double gain;
+    };
+
+    struct Draining
+    {
+        std::uint64_t deadline;
+        std::uint64_t pending;
+    };
+
+    using Config = stct::Variant< Idle, Running, Draining >;
+
+    struct LockedConfig
+    {
+        Config load() const
+        {
+            std::lock_guard lock(mutex);
+            return value;
+        }
+
+        void store(const Config & config)
+        {
+            std::lock_guard lock(mutex);
+            value = config;
+        }
+
+        mutable std::mutex mutex;
+        Config value;
+    };
+
+    std::uint64_t weight(const Config & config)
+    {
+        return stct::visit(
+         [](const auto & state) -> std::uint64_t
+         {
+             if constexpr (std::is_same_v< decltype(state), const Running & >)
+             {
+                 return state.rate;
+             }
+             else if constexpr (std::is_same_v< decltype(state), const Draining & >)
+             {
+                 return state.pending;
+             }
+             else
+             {
+                 return 0;
+             }
+         },
+         config);
+    }
+
+    /// readers threads load LOADS times each while one writer keeps storing
+    template < typename Published >
+    std::uint64_t run_readers(Published & published, size_t readers)
+    {
+        std::atomic< bool > done = false;
+        std::atomic< std::uint64_t > total = 0;
+        std::thread writer(
+         [&]()
+         {
+             for (std::uint32_t i = 0; !done.load(std::memory_order_relaxed); ++i)
+             {
+                 published.store(i % 2 == 0 ? Config{ Running{ i, i, 0.5 } }
+                                            : Config{ Draining{ i, i } });
+             }
+         });
+        std::vector< std::thread > threads;
+        for (size_t r = 0; r < readers; ++r)
+        {
+            threads.emplace_back(
+             [&]()
+             {
+                 std::uint64_t sum = 0;
+                 for (size_t i = 0; i < LOADS; ++i)
+                 {
+                     sum += weight(published.load());
+                 }
+                 total += sum;
+             });
+        }
+        for (auto & thread: threads)
+        {
+            thread.join();
+        }
+        done = true;
+        writer.join();
+        return total;
+    }
+}
+
+TEST_CASE("atomic variant benchmarking")
+{
+    stct::AtomicVariant< Idle, Running, Draining > atomic;
+    LockedConfig locked;
+    for (size_t readers: { 1, 2, 4, 8 })
+    {
+        const auto suffix = " <" + std::to_string(readers) + " readers>";
+
+        BENCHMARK("mutex Variant" + suffix)
+        {
+            return run_readers(locked, readers);
+        };
+
+        BENCHMARK("AtomicVariant" + suffix)
+        {
+            return run_readers(atomic, readers);
+        };
+    }
+}
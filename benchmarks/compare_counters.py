@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Flags regressions between two reports written by the benchmark target.
+
+    STCT_PERF_JSON=base.json ./benchmark
+    STCT_PERF_JSON=head.json ./benchmark
+    benchmarks/compare_counters.py base.json head.json --threshold 5
+
+Every metric is "lower is better". A metric regresses when head exceeds base by more than
+threshold percent. Metrics missing from either report (counters unavailable) are skipped.
+Counters only compare fairly when both reports had the "perf counter baseline" benchmark
+subtracted. Exit code is 1 if anything regressed.
+"""
+
+import argparse
+import json
+import sys
+
+METRICS = ["mean_ns", "cycles", "instructions", "branch_misses", "cache_misses", "l1d_misses"]
+
+
+def load(path):
+    with open(path) as f:
+        report = json.load(f)
+    if not report.get("baseline_subtracted", False):
+        print(f"warning: {path} has no baseline subtracted, counters include Catch's own work")
+    return {bench["name"]: bench for bench in report["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("base")
+    parser.add_argument("head")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed growth in percent (default: %(default)s)")
+    parser.add_argument("--metrics", nargs="+", default=METRICS, choices=METRICS)
+    args = parser.parse_args()
+
+    base = load(args.base)
+    head = load(args.head)
+    regressions = 0
+    for name in sorted(base.keys() & head.keys()):
+        for metric in args.metrics:
+            old, new = base[name].get(metric), head[name].get(metric)
+            if old is None or new is None:
+                continue
+            change = (new - old) / old * 100 if old else (0.0 if new == old else float("inf"))
+            regressed = change > args.threshold
+            regressions += regressed
+            if regressed or change < -args.threshold:
+                print(f"{'REGRESSION' if regressed else 'improvement':<11} {name} {metric}: "
+                      f"{old:.4g} -> {new:.4g} ({change:+.1f}%)")
+    for name in sorted(base.keys() - head.keys()):
+        print(f"{'missing':<11} {name}")
+    for name in sorted(head.keys() - base.keys()):
+        print(f"{'new':<11} {name}")
+
+    print(f"{regressions} regression(s) above {args.threshold}%")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
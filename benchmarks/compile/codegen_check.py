@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Checks that forwarding helpers cost nothing once optimized.
+
+    benchmarks/compile/codegen_check.py --cxx g++ --include inc --opt 3
+
+fwd_codegen.cpp defines pairs of functions: direct_<name> calls its callee by hand, fwd_<name>
+goes through the fwd_* helper of the same name. Both are compiled to assembly and every pair
+must come out instruction for instruction the same. Exits with 1 otherwise. --opt takes the
+optimization level without its dash, as in --opt 3 or --opt s, and defaults to 2.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "fwd_codegen.cpp")
+LABEL = re.compile(r"^([A-Za-z_][A-Za-z0-9_]*):")
+
+
+def functions(asm):
+    """Instructions of every function in the listing, local labels and directives dropped."""
+    result = {}
+    current = None
+    for line in asm.splitlines():
+        match = LABEL.match(line)
+        if match:
+            current = result.setdefault(match.group(1), [])
+            continue
+        line = line.strip()
+        if current is None or not line or line.startswith((".", "#")) or line.endswith(":"):
+            continue
+        current.append(line.split("#")[0].strip())
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", required=True)
+    parser.add_argument("--opt", default="2", choices=["1", "2", "3", "s", "z", "fast"],
+                        help="optimization level, passed as -O<level> (default: %(default)s)")
+    args = parser.parse_args()
+
+    cmd = [args.cxx, "-std=c++20", f"-O{args.opt}", "-fno-asynchronous-unwind-tables", "-S", "-o", "-",
+           "-I", args.include, SOURCE]
+    asm = subprocess.run(cmd, check=True, capture_output=True, text=True).stdout
+    funcs = functions(asm)
+
+    failed = False
+    for name in sorted(n[len("direct_"):] for n in funcs if n.startswith("direct_")):
+        direct = funcs[f"direct_{name}"]
+        fwd = funcs.get(f"fwd_{name}")
+        same = fwd is not None and fwd == direct
+        failed |= not same
+        print(f"{name:>10}: {'same' if same else 'DIFFERS'} ({len(direct)} instructions)")
+        if not same:
+            print("  direct:\n    " + "\n    ".join(direct), file=sys.stderr)
+            print("  fwd:\n    " + "\n    ".join(fwd or ["<missing>"]), file=sys.stderr)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Records build time and peak compiler memory of pack_sort.cpp for growing pack sizes.
+
+    benchmarks/compile/compile_time.py --cxx g++ --include inc --output compile_time.json
+
+Both keyed (size_of::less) and unkeyed comparators are measured. The compiler only checks the
+translation unit (-fsyntax-only): sorting happens entirely during template instantiation.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "pack_sort.cpp")
+
+
+def measure(cxx, include, size, unkeyed):
+    cmd = [cxx, "-std=c++20", "-fsyntax-only", "-I", include, f"-DPACK_SIZE={size}", SOURCE]
+    if unkeyed:
+        cmd.append("-DUNKEYED_COMPARATOR")
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stderr=subprocess.PIPE)
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = time.perf_counter() - start
+    stderr = proc.stderr.read().decode()
+    proc.stderr.close()
+    return {
+        "pack_size": size,
+        "comparator": "unkeyed" if unkeyed else "keyed",
+        "ok": os.waitstatus_to_exitcode(status) == 0,
+        "seconds": round(elapsed, 3),
+        "max_rss_kib": usage.ru_maxrss,
+        "error": stderr.splitlines()[0] if status and stderr else None,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", required=True)
+    parser.add_argument("--sizes", type=int, nargs="+", default=[25, 50, 100, 200])
+    parser.add_argument("--output", help="JSON report path, stdout if omitted")
+    args = parser.parse_args()
+
+    results = []
+    for unkeyed in (False, True):
+        for size in args.sizes:
+            result = measure(args.cxx, args.include, size, unkeyed)
+            print(f"{result['comparator']:>8} {size:>5} types: {result['seconds']:>7.3f} s, "
+                  f"{result['max_rss_kib'] / 1024:>7.1f} MiB{'' if result['ok'] else ' FAILED'}",
+                  file=sys.stderr)
+            results.append(result)
+
+    report = json.dumps({"compiler": args.cxx, "results": results}, indent=2)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(report + "\n")
+    else:
+        print(report)
+    return 0 if all(result["ok"] for result in results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,93 @@
+// Each fwd_* function must compile to the same instructions as its direct_* twin, see
+// codegen_check.py. Callees are only declared, so the calls themselves stay in the output
+
+#include "comparators.hpp"
+#include "fwd.hpp"
+
+#include <utility>
+
+namespace stct = static_containers;
+
+struct Big
+{
+    long words[4];
+};
+
+extern "C" long sink(char c, int i, long l, const Big & big);
+extern "C" long sink_sorted(const Big & big, long l, int i, char c);
+extern "C" long sink_sliced(int i, long l);
+
+namespace
+{
+    constexpr auto to_sink = [](auto &&... args)
+    {
+        return sink(std::forward< decltype(args) >(args)...);
+    };
+}
+
+extern "C" long direct_permuted(long l, char c, const Big & big, int i)
+{
+    return sink(c, i, l, big);
+}
+
+extern "C" long fwd_permuted(long l, char c, const Big & big, int i)
+{
+    return stct::fwd_permuted< 1, 3, 0, 2 >(to_sink, l, c, big, i);
+}
+
+extern "C" long direct_reversed(const Big & big, long l, int i, char c)
+{
+    return sink(c, i, l, big);
+}
+
+extern "C" long fwd_reversed(const Big & big, long l, int i, char c)
+{
+    return stct::fwd_reversed(to_sink, big, l, i, c);
+}
+
+extern "C" long direct_swapped(long l, int i, char c, const Big & big)
+{
+    return sink(c, i, l, big);
+}
+
+extern "C" long fwd_swapped(long l, int i, char c, const Big & big)
+{
+    return stct::fwd_swapped< 0, 2 >(to_sink, l, i, c, big);
+}
+
+extern "C" long direct_sliced(char c, int i, long l, const Big & big)
+{
+    return sink_sliced(i, l) + c + big.words[0];
+}
+
+extern "C" long fwd_sliced(char c, int i, long l, const Big & big)
+{
+    return stct::fwd_sliced< 1, 3 >(
+            [](int i, long l)
+            {
+                return sink_sliced(i, l);
+            },
+            c,
+            i,
+            l,
+            big) +
+           c + big.words[0];
+}
+
+extern "C" long direct_sorted(char c, int i, long l, const Big & big)
+{
+    return sink_sorted(big, l, i, c);
+}
+
+extern "C" long fwd_sorted(char c, int i, long l, const Big & big)
+{
+    return stct::fwd_sorted< stct::comparators::size_of::greater >(
+     [](const Big & big, long l, int i, char c)
+     {
+         return sink_sorted(big, l, i, c);
+     },
+     c,
+     i,
+     l,
+     big);
+}
@@ -0,0 +1,58 @@
+// Compiled, not run, by compile_time.py: cost of sorting a pack of PACK_SIZE types
+#include "comparators.hpp"
+#include "fwd.hpp"
+#include "traits.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#ifndef PACK_SIZE
+#define PACK_SIZE 50
+#endif
+
+namespace stct = static_containers;
+
+namespace
+{
+    template < size_t I >
+    struct Sized
+    {
+        static constexpr size_t index = I;
+        char bytes[(I * 7) % 13 + 1];
+    };
+
+#ifdef UNKEYED_COMPARATOR
+    struct SizeLess
+    {
+        template < typename T1, typename T2 >
+        constexpr static bool value() noexcept
+        {
+            return sizeof(T1) < sizeof(T2);
+        }
+    };
+#else
+    using SizeLess = stct::comparators::size_of::less;
+#endif
+
+    template < size_t... Is >
+    auto make_pack(std::index_sequence< Is... >) -> stct::pack< Sized< Is >... >;
+
+    using Pack = decltype(make_pack(std::make_index_sequence< PACK_SIZE >{}));
+    using Sorted = Pack::sorted< SizeLess >;
+
+    static_assert(Sorted::is_sorted< SizeLess >());
+
+    template < size_t... Is >
+    constexpr size_t sorted_first(std::index_sequence< Is... >)
+    {
+        return stct::fwd_sorted< SizeLess >(
+         [](const auto & first, const auto &...)
+         {
+             return first.index;
+         },
+         Sized< Is >{}...);
+    }
+
+    static_assert(sorted_first(std::make_index_sequence< PACK_SIZE >{}) ==
+                  Sorted::type_at< 0 >::index);
+}
@@ -0,0 +1,137 @@
+#include "event_bus.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stct = static_containers;
+
+namespace
+{
+    constexpr size_t EMITS = 1024;
+
+    struct Tick
+    {
+        std::uint64_t frame;
+    };
+
+    struct Input
+    {
+        std::uint64_t key;
+    };
+
+    /// Cheap subscriber, so that the cost of reaching it dominates. Odd ones also take Input
+    template < size_t I >
+    struct Counter
+    {
+        void operator()(const Tick & tick) noexcept
+        {
+            total += tick.frame * (I + 1);
+        }
+
+        void operator()(const Input & input) noexcept
+            requires(I % 2 == 1)
+        {
+            total ^= input.key;
+        }
+
+        std::uint64_t total = 0;
+    };
+
+    template < size_t... Is >
+    void run_light(std::index_sequence< Is... >)
+    {
+        auto bus = stct::make_event_bus(Counter< Is >{}...);
+        stct::Tuple< Counter< Is >... > targets{ Counter< Is >{}... };
+        std::vector< std::function< void(const Tick &) > > tick_handlers;
+        std::vector< std::function< void(const Input &) > > input_handlers;
+        (tick_handlers.push_back(std::ref(targets.template at< Is >())), ...);
+        (
+         [&]()
+         {
+             if constexpr (Is % 2 == 1)
+             {
+                 input_handlers.push_back(std::ref(targets.template at< Is >()));
+             }
+         }(),
+         ...);
+        const auto suffix = " <" + std::to_string(sizeof...(Is)) + " subscribers>";
+
+        BENCHMARK("vector of std::function" + suffix)
+        {
+            for (std::uint64_t i = 0; i < EMITS; ++i)
+            {
+                for (auto & handler: tick_handlers)
+                {
+                    handler(Tick{ i });
+                }
+                for (auto & handler: input_handlers)
+                {
+                    handler(Input{ i });
+                }
+            }
+            return (targets.template at< Is >().total + ...);
+        };
+
+        BENCHMARK("EventBus::emit" + suffix)
+        {
+            for (std::uint64_t i = 0; i < EMITS; ++i)
+            {
+                bus.emit(Tick{ i });
+                bus.emit(Input{ i });
+            }
+            return (bus.template subscriber< Is >().total + ...);
+        };
+    }
+
+    /// Subscriber doing real work on every Tick: a pass over its own data
+    template < size_t I >
+    struct Hasher
+    {
+        void operator()(const Tick & tick) noexcept
+        {
+            std::uint64_t hash = 14695981039346656037ull ^ tick.frame;
+            for (auto word: data)
+            {
+                hash = (hash ^ word) * 1099511628211ull;
+            }
+            result = hash;
+        }
+
+        std::vector< std::uint32_t > data;
+        std::uint64_t result = 0;
+    };
+
+    template < size_t... Is >
+    void run_heavy(size_t size, std::index_sequence< Is... >)
+    {
+        auto bus = stct::make_event_bus(Hasher< Is >{ std::vector< std::uint32_t >(size, Is) }...);
+        const auto suffix = " <" + std::to_string(sizeof...(Is)) + " x " + std::to_string(size) +
+         " words>";
+
+        BENCHMARK("EventBus::emit" + suffix)
+        {
+            bus.emit(Tick{ 1 });
+            return (bus.template subscriber< Is >().result ^ ...);
+        };
+
+        BENCHMARK("EventBus::parallel_emit" + suffix)
+        {
+            bus.parallel_emit(Tick{ 1 });
+            return (bus.template subscriber< Is >().result ^ ...);
+        };
+    }
+}
+
+TEST_CASE("event bus benchmarking")
+{
+    run_light(std::make_index_sequence< 8 >{});
+    run_heavy(1 << 12, std::make_index_sequence< 8 >{});
+    run_heavy(1 << 18, std::make_index_sequence< 8 >{});
+}
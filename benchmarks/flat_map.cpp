@@ -0,0 +1,220 @@
+#include "flat_map.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t LOOKUPS = 4096;
+    using Entry = std::pair< std::uint64_t, std::uint64_t >;
+
+    /// Hand-rolled flat map over one sorted vector of pairs: std::lower_bound, then vector::insert
+    class SortedVector
+    {
+       public:
+        const std::uint64_t * find(std::uint64_t key) const
+        {
+            auto it = lower_bound(key);
+            return it != entries_.end() && it->first == key ? &it->second : nullptr;
+        }
+
+        void insert(std::uint64_t key, std::uint64_t value)
+        {
+            auto it = lower_bound(key);
+            if (it == entries_.end() || it->first != key)
+            {
+                entries_.insert(it, { key, value });
+            }
+        }
+
+        /// Sorts the new entries then merges them in, as C++23 std::flat_map::insert_range does
+        void insert_range(const std::vector< Entry > & incoming)
+        {
+            auto middle = entries_.insert(entries_.end(), incoming.begin(), incoming.end());
+            std::stable_sort(middle, entries_.end(), by_key);
+            std::inplace_merge(entries_.begin(), middle, entries_.end(), by_key);
+            entries_.erase(std::unique(entries_.begin(),
+                            entries_.end(),
+                            [](const Entry & lhs, const Entry & rhs)
+                            { return lhs.first == rhs.first; }),
+             entries_.end());
+        }
+
+        size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+
+       private:
+        static bool by_key(const Entry & lhs, const Entry & rhs) noexcept
+        {
+            return lhs.first < rhs.first;
+        }
+
+        std::vector< Entry >::const_iterator lower_bound(std::uint64_t key) const
+        {
+            return std::lower_bound(entries_.begin(),
+             entries_.end(),
+             key,
+             [](const Entry & entry, std::uint64_t k) { return entry.first < k; });
+        }
+
+        std::vector< Entry > entries_;
+    };
+
+    /// Entries to insert, then a lookup stream hitting them half of the time
+    struct Workload
+    {
+        std::vector< Entry > entries;
+        std::vector< std::uint64_t > lookups;
+    };
+
+    Workload make_workload(size_t count)
+    {
+        std::mt19937_64 rng(bench::SEED);
+        Workload result;
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto key = rng();
+            result.entries.emplace_back(key, key);
+        }
+        auto picks = bench::make_indices(bench::Distribution::Uniform, count, LOOKUPS);
+        for (size_t i = 0; i < LOOKUPS; ++i)
+        {
+            result.lookups.push_back(i % 2 == 0 ? result.entries[picks[i]].first : rng());
+        }
+        return result;
+    }
+
+    template < typename Map >
+    std::uint64_t find_all(const Map & map, const std::vector< std::uint64_t > & lookups)
+    {
+        std::uint64_t result = 0;
+        for (auto key: lookups)
+        {
+            auto * value = map.find(key);
+            result += value == nullptr ? 1 : *value;
+        }
+        return result;
+    }
+
+    template < size_t COUNT >
+    void run_case()
+    {
+        using FlatMap = stct::FlatMap< std::uint64_t, std::uint64_t, COUNT >;
+        constexpr size_t count = COUNT;
+        const auto workload = make_workload(count);
+        const auto suffix = " <" + std::to_string(count) + " entries>";
+
+        BENCHMARK("std::map insert" + suffix)
+        {
+            std::map< std::uint64_t, std::uint64_t > map;
+            for (auto [key, value]: workload.entries)
+            {
+                map.try_emplace(key, value);
+            }
+            return map.size();
+        };
+
+        BENCHMARK("sorted std::vector insert" + suffix)
+        {
+            SortedVector map;
+            for (auto [key, value]: workload.entries)
+            {
+                map.insert(key, value);
+            }
+            return map.size();
+        };
+
+        BENCHMARK("FlatMap insert" + suffix)
+        {
+            FlatMap map;
+            for (auto [key, value]: workload.entries)
+            {
+                map.try_emplace(key, value);
+            }
+            return map.size();
+        };
+
+        // one range fills half of the map, a second one merges into it
+        const std::vector< Entry > first(
+         workload.entries.begin(), workload.entries.begin() + count / 2);
+        const std::vector< Entry > second(
+         workload.entries.begin() + count / 2, workload.entries.end());
+
+        BENCHMARK("std::map insert range" + suffix)
+        {
+            std::map< std::uint64_t, std::uint64_t > map;
+            map.insert(first.begin(), first.end());
+            map.insert(second.begin(), second.end());
+            return map.size();
+        };
+
+        BENCHMARK("sorted std::vector insert range" + suffix)
+        {
+            SortedVector map;
+            map.insert_range(first);
+            map.insert_range(second);
+            return map.size();
+        };
+
+        BENCHMARK("FlatMap insert range" + suffix)
+        {
+            FlatMap map;
+            map.insert_range(first);
+            map.insert_range(second);
+            return map.size();
+        };
+
+        std::map< std::uint64_t, std::uint64_t > std_map;
+        SortedVector sorted;
+        FlatMap flat;
+        for (auto [key, value]: workload.entries)
+        {
+            std_map.try_emplace(key, value);
+            sorted.insert(key, value);
+            flat.try_emplace(key, value);
+        }
+
+        BENCHMARK("std::map find" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (auto key: workload.lookups)
+            {
+                auto it = std_map.find(key);
+                result += it == std_map.end() ? 1 : it->second;
+            }
+            return result;
+        };
+
+        BENCHMARK("sorted std::vector find" + suffix)
+        {
+            return find_all(sorted, workload.lookups);
+        };
+
+        BENCHMARK("FlatMap find" + suffix)
+        {
+            return find_all(flat, workload.lookups);
+        };
+    }
+}
+
+TEST_CASE("flat map benchmarking")
+{
+    run_case< 64 >();
+    run_case< 1024 >();
+    run_case< 4096 >();
+}
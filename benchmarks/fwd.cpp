@@ -0,0 +1,77 @@
+#include "comparators.hpp"
+#include "fwd.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace stct = static_containers;
+
+namespace
+{
+    constexpr size_t CALLS = 1024;
+
+    /// Takes its arguments by reference, so any copy made on the way is the helper's own
+    size_t consume(const std::string & a, const std::string & b, size_t c, char d)
+    {
+        return a.size() + b.size() + c + static_cast< size_t >(d);
+    }
+
+    constexpr auto to_consume = [](auto &&... args)
+    {
+        return consume(std::forward< decltype(args) >(args)...);
+    };
+}
+
+/// Compile-time counterpart is benchmarks/compile/codegen_check.py, which compares instructions
+TEST_CASE("fwd benchmarking")
+{
+    const std::string a(64, 'a');
+    const std::string b(64, 'b');
+
+    BENCHMARK("direct call")
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < CALLS; ++i)
+        {
+            result += consume(a, b, i, 'c');
+        }
+        return result;
+    };
+
+    BENCHMARK("fwd swapped")
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < CALLS; ++i)
+        {
+            result += stct::fwd_swapped< 0, 1 >(to_consume, b, a, i, 'c');
+        }
+        return result;
+    };
+
+    BENCHMARK("fwd reversed")
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < CALLS; ++i)
+        {
+            result += stct::fwd_reversed(to_consume, 'c', i, b, a);
+        }
+        return result;
+    };
+
+    BENCHMARK("fwd sorted")
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < CALLS; ++i)
+        {
+            result += stct::fwd_sorted< stct::comparators::size_of::greater >(to_consume,
+             'c',
+             a,
+             i,
+             b);
+        }
+        return result;
+    };
+}
@@ -0,0 +1,95 @@
+#include "inplace_function.hpp"
+#include "vector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t HANDLERS = 64;
+    constexpr size_t CALLS = 4096;
+
+    /// Captures three words: past the small buffer of std::function in the common implementations,
+    /// within the default capacity of InplaceFunction
+    template < typename Function >
+    Function make_handler(std::uint64_t * sink, std::uint64_t scale, std::uint64_t bias)
+    {
+        return [sink, scale, bias](std::uint64_t value)
+        {
+            *sink += value * scale + bias;
+        };
+    }
+
+    template < typename Handlers >
+    void fill(Handlers & handlers, std::uint64_t * sink)
+    {
+        for (std::uint64_t i = 0; i < HANDLERS; ++i)
+        {
+            handlers.push_back(make_handler< typename Handlers::value_type >(sink, i + 1, i));
+        }
+    }
+
+    /// Calls handlers in a shuffled order, as events picking their handler at runtime would
+    template < typename Handlers >
+    std::uint64_t call_all(Handlers & handlers, const std::vector< size_t > & order)
+    {
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            handlers[order[i]](i);
+        }
+        return order.size();
+    }
+
+    template < typename Function >
+    struct StdVector : std::vector< Function >
+    {
+        using value_type = Function;
+    };
+
+    struct InplaceVector : stct::Vector< stct::InplaceFunction< void(std::uint64_t) >, HANDLERS >
+    {
+        using value_type = stct::InplaceFunction< void(std::uint64_t) >;
+    };
+
+    template < typename Handlers >
+    void run_case(const char * name)
+    {
+        const auto order = bench::make_indices(bench::Distribution::Uniform, HANDLERS, CALLS);
+        std::uint64_t sink = 0;
+        Handlers handlers;
+        fill(handlers, &sink);
+
+        BENCHMARK(std::string(name) + " <call>")
+        {
+            call_all(handlers, order);
+            return sink;
+        };
+
+        BENCHMARK(std::string(name) + " <build>")
+        {
+            Handlers built;
+            fill(built, &sink);
+            return built.size();
+        };
+    }
+}
+
+TEST_CASE("inplace function benchmarking")
+{
+    run_case< StdVector< std::function< void(std::uint64_t) > > >("std::function");
+#ifdef __cpp_lib_move_only_function
+    run_case< StdVector< std::move_only_function< void(std::uint64_t) > > >(
+     "std::move_only_function");
+#endif
+    run_case< InplaceVector >("InplaceFunction");
+}
@@ -0,0 +1,17 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+
+#include "map_matrix.hpp"
+
+namespace bench = static_containers::benchmarking;
+
+namespace
+{
+    /// This one case takes longer to build than the whole of matrix.cpp
+    constexpr size_t LARGE_KEY_COUNT = 1024;
+}
+
+TEST_CASE("large map matrix", "[large_map]")
+{
+    bench::map_case< LARGE_KEY_COUNT >();
+}
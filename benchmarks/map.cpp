@@ -1,13 +1,23 @@
 #include "map.hpp"
+#include "static_string.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
+#include <functional>
 #include <map>
+#include <string>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "workload.hpp"
 
 namespace stct = static_containers;
+namespace bench = stct::benchmarking;
 
 namespace
 {
+    constexpr size_t LOOKUPS = 1024;
+
     struct Set0
     {
         constexpr void operator()() const noexcept
@@ -33,28 +43,61 @@ TEST_CASE("map benchmarking")
     };
     auto set3 = std::bind(set_some, std::ref(to_set), 3);
 
-    BENCHMARK("std map")
+    const auto std_map =
+     std::map< std::string, std::function< void() > >{ { "set0", Set0(to_set) },
+         { "set2", set2 },
+         { "set3", set3 } };
+    const auto stct_map =
+     stct::make_map< std::string >(stct::Tuple{ std::string("set0"), Set0(to_set) },
+      stct::Tuple{ std::string("set2"), set2 },
+      stct::Tuple{ std::string("set3"), set3 });
+    using Key = stct::StaticString< 8 >;
+    const auto static_map = stct::make_map< Key >(stct::Tuple{ Key("set0"), Set0(to_set) },
+     stct::Tuple{ Key("set2"), set2 },
+     stct::Tuple{ Key("set3"), set3 });
+    const std::vector< std::string > keys = { "set0", "set2", "set3" };
+
+    for (auto distribution: bench::distributions())
     {
+        const auto stream = bench::make_keys(distribution, keys, LOOKUPS);
+        const std::vector< Key > static_stream(stream.begin(), stream.end());
+        const std::string suffix = " (" + std::string(bench::name_of(distribution)) + ")";
 
-        static const auto map =
-         std::map< std::string, std::function< void() > >{ { "set0", Set0(to_set) },
-             { "set2", set2 },
-             { "set3", set3 } };
-        map.at("set0")();
-        map.at("set2")();
-        return map.at("set3")();
-    };
+        BENCHMARK("std map" + suffix)
+        {
+            for (const auto & key: stream)
+            {
+                std_map.at(key)();
+            }
+            return to_set;
+        };
 
-    BENCHMARK("stct map")
-    {
-        auto set3 = std::bind(set_some, std::ref(to_set), 3);
-        static const auto map =
-         stct::make_map< std::string >(stct::Tuple{ std::string("set0"), Set0(to_set) },
-          stct::Tuple{ std::string("set2"), set2 },
-          stct::Tuple{ std::string("set3"), set3 });
-        using namespace stct::visitors;
-        call_at(map, "set0");
-        call_at(map, "set2");
-        return call_at(map, "set3");
-    };
-}
\ No newline at end of file
+        BENCHMARK("stct map" + suffix)
+        {
+            using namespace stct::visitors;
+            for (const auto & key: stream)
+            {
+                call_at(stct_map, key);
+            }
+            return to_set;
+        };
+
+        BENCHMARK("stct map, StaticString keys" + suffix)
+        {
+            using namespace stct::visitors;
+            for (const auto & key: static_stream)
+            {
+                call_at(static_map, key);
+            }
+            return to_set;
+        };
+
+        stct::testing::AllocationScope scope;
+        for (const auto & key: stream)
+        {
+            stct::visitors::call_at(stct_map, key);
+        }
+        auto allocations = scope.allocations();
+        REQUIRE(allocations == 0);
+    }
+}
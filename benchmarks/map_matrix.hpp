@@ -0,0 +1,77 @@
+#ifndef BENCH_MAP_MATRIX_HPP
+#define BENCH_MAP_MATRIX_HPP
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "map.hpp"
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+#include "workload.hpp"
+
+namespace static_containers::benchmarking
+{
+    /// Lookups of one map case
+    constexpr size_t MAP_LOOKUPS = 1024;
+
+    template < size_t I >
+    struct Handler
+    {
+        void operator()() const noexcept
+        {
+            *sink += I;
+        }
+
+        size_t * sink;
+    };
+
+    template < size_t... Is >
+    auto make_stct_map(size_t & sink, std::index_sequence< Is... >)
+    {
+        return make_map< int >(Tuple{ int(Is), Handler< Is >{ &sink } }...);
+    }
+
+    template < size_t... Is >
+    auto make_std_map(size_t & sink, std::index_sequence< Is... >)
+    {
+        return std::map< int, std::function< void() > >{ { int(Is), Handler< Is >{ &sink } }... };
+    }
+
+    /// stct map against std::map, both of K keys each calling its own handler. Build time grows
+    /// quadratically with K
+    template < size_t K >
+    void map_case()
+    {
+        size_t sink = 0;
+        const auto stct_map = make_stct_map(sink, std::make_index_sequence< K >{});
+        const auto std_map = make_std_map(sink, std::make_index_sequence< K >{});
+        const auto stream = make_indices(Distribution::Uniform, K, MAP_LOOKUPS);
+        const std::string suffix = " <" + std::to_string(K) + " keys>";
+
+        BENCHMARK("stct map" + suffix)
+        {
+            using namespace visitors;
+            for (auto idx: stream)
+            {
+                call_at(stct_map, int(idx));
+            }
+            return sink;
+        };
+
+        BENCHMARK("std map" + suffix)
+        {
+            for (auto idx: stream)
+            {
+                std_map.at(int(idx))();
+            }
+            return sink;
+        };
+    }
+}
+
+#endif
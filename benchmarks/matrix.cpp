@@ -0,0 +1,326 @@
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+#include "variant.hpp"
+#include "vector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "map_matrix.hpp"
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t LOOKUPS = 1024;
+    constexpr size_t VARIANTS = 1024;
+
+    struct MoveOnly
+    {
+        explicit MoveOnly(size_t v = 0):
+          v(v)
+        {}
+
+        MoveOnly(const MoveOnly &) = delete;
+        MoveOnly & operator=(const MoveOnly &) = delete;
+
+        MoveOnly(MoveOnly && rhs) noexcept:
+          v(std::exchange(rhs.v, 0))
+        {}
+
+        MoveOnly & operator=(MoveOnly && rhs) noexcept
+        {
+            v = std::exchange(rhs.v, 0);
+            return *this;
+        }
+
+        size_t v;
+    };
+
+    struct Bytes64
+    {
+        std::array< std::uint64_t, 8 > words;
+    };
+
+    static_assert(sizeof(Bytes64) == 64);
+
+    template < typename... Ts >
+    struct Types
+    {};
+
+    /// Vector, Variant and Tuple run over every one of these
+    using Elements = Types< double, std::string, MoveOnly, Bytes64 >;
+    using Capacities = std::index_sequence< 8, 64, 512, 4096, 65536 >;
+    /// Bigger maps are in large/, built only with STCT_LARGE_BENCHMARKS
+    using KeyCounts = std::index_sequence< 2, 8, 32, 128, 512 >;
+
+    template < typename T >
+    constexpr const char * name_of() noexcept
+    {
+        if constexpr (std::is_same_v< T, double >)
+        {
+            return "double";
+        }
+        else if constexpr (std::is_same_v< T, std::string >)
+        {
+            return "string";
+        }
+        else if constexpr (std::is_same_v< T, MoveOnly >)
+        {
+            return "move-only";
+        }
+        else
+        {
+            return "64B struct";
+        }
+    }
+
+    template < typename T >
+    T make(size_t i)
+    {
+        if constexpr (std::is_same_v< T, double >)
+        {
+            return static_cast< double >(i);
+        }
+        else if constexpr (std::is_same_v< T, std::string >)
+        {
+            return std::to_string(i);
+        }
+        else if constexpr (std::is_same_v< T, MoveOnly >)
+        {
+            return MoveOnly{ i };
+        }
+        else
+        {
+            return Bytes64{ { i, i, i, i, i, i, i, i } };
+        }
+    }
+
+    template < typename T >
+    size_t key(const T & elem)
+    {
+        if constexpr (std::is_same_v< T, double >)
+        {
+            return static_cast< size_t >(elem);
+        }
+        else if constexpr (std::is_same_v< T, std::string >)
+        {
+            return elem.size();
+        }
+        else if constexpr (std::is_same_v< T, MoveOnly >)
+        {
+            return elem.v;
+        }
+        else
+        {
+            return elem.words[0];
+        }
+    }
+
+    size_t key(int elem)
+    {
+        return elem;
+    }
+
+    template < typename Range >
+    size_t consume(const Range & range)
+    {
+        size_t result = 0;
+        for (const auto & elem: range)
+        {
+            result += key(elem);
+        }
+        return result;
+    }
+
+    /// Containers live on the heap: the biggest of them do not fit on the stack
+    template < typename T, size_t N >
+    void vector_case()
+    {
+        const auto suffix = std::string(" <") + name_of< T >() + ", " + std::to_string(N) + ">";
+
+        auto stct_vec = std::make_unique< stct::Vector< T, N > >();
+        BENCHMARK("stct vector" + suffix)
+        {
+            auto & vec = *stct_vec;
+            vec.clear();
+            for (size_t i = 0; i < N; ++i)
+            {
+                vec.emplace_back(make< T >(i));
+            }
+            return consume(vec);
+        };
+
+        auto std_vec = std::make_unique< std::vector< T > >();
+        std_vec->reserve(N);
+        BENCHMARK("std vector" + suffix)
+        {
+            auto & vec = *std_vec;
+            vec.clear();
+            for (size_t i = 0; i < N; ++i)
+            {
+                vec.emplace_back(make< T >(i));
+            }
+            return consume(vec);
+        };
+
+        auto std_arr = std::make_unique< std::array< T, N > >();
+        BENCHMARK("std array" + suffix)
+        {
+            auto & arr = *std_arr;
+            for (size_t i = 0; i < N; ++i)
+            {
+                arr[i] = make< T >(i);
+            }
+            return consume(arr);
+        };
+    }
+
+    template < typename T >
+    void variant_case()
+    {
+        const auto stream = bench::make_indices(bench::Distribution::Uniform, 2, VARIANTS);
+        const std::string suffix = std::string(" <") + name_of< T >() + ", int>";
+
+        auto stct_vars = std::make_unique< std::array< stct::Variant< T, int >, VARIANTS > >();
+        BENCHMARK("stct variant" + suffix)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < VARIANTS; ++i)
+            {
+                auto & var = (*stct_vars)[i];
+                if (stream[i] == 0)
+                {
+                    var = make< T >(i);
+                }
+                else
+                {
+                    var = int(i);
+                }
+                result += stct::visit(var,
+                 [](const auto & alt)
+                 {
+                     return key(alt);
+                 });
+            }
+            return result;
+        };
+
+        auto std_vars = std::make_unique< std::array< std::variant< T, int >, VARIANTS > >();
+        BENCHMARK("std variant" + suffix)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < VARIANTS; ++i)
+            {
+                auto & var = (*std_vars)[i];
+                if (stream[i] == 0)
+                {
+                    var = make< T >(i);
+                }
+                else
+                {
+                    var = int(i);
+                }
+                result += std::visit(
+                 [](const auto & alt)
+                 {
+                     return key(alt);
+                 },
+                 var);
+            }
+            return result;
+        };
+    }
+
+    template < typename T >
+    void tuple_case()
+    {
+        const std::string suffix = std::string(" <") + name_of< T >() + " x4>";
+
+        BENCHMARK("stct tuple" + suffix)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < LOOKUPS; ++i)
+            {
+                stct::Tuple< T, T, T, T > tuple{ make< T >(i),
+                    make< T >(i + 1),
+                    make< T >(i + 2),
+                    make< T >(i + 3) };
+                stct::for_each(tuple.view_full(),
+                 [&](const auto & elem)
+                 {
+                     result += key(elem);
+                 });
+            }
+            return result;
+        };
+
+        BENCHMARK("std tuple" + suffix)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < LOOKUPS; ++i)
+            {
+                std::tuple< T, T, T, T > tuple{ make< T >(i),
+                    make< T >(i + 1),
+                    make< T >(i + 2),
+                    make< T >(i + 3) };
+                std::apply(
+                 [&](const auto &... elems)
+                 {
+                     ((result += key(elems)), ...);
+                 },
+                 tuple);
+            }
+            return result;
+        };
+    }
+
+    template < typename T, size_t... Ns >
+    void vector_row(std::index_sequence< Ns... >)
+    {
+        (vector_case< T, Ns >(), ...);
+    }
+}
+
+TEST_CASE("vector matrix")
+{
+    []< typename... Ts >(Types< Ts... >)
+    {
+        (vector_row< Ts >(Capacities{}), ...);
+    }(Elements{});
+}
+
+TEST_CASE("map matrix")
+{
+    []< size_t... Ks >(std::index_sequence< Ks... >)
+    {
+        (bench::map_case< Ks >(), ...);
+    }(KeyCounts{});
+}
+
+TEST_CASE("variant matrix")
+{
+    []< typename... Ts >(Types< Ts... >)
+    {
+        (variant_case< Ts >(), ...);
+    }(Elements{});
+}
+
+TEST_CASE("tuple matrix")
+{
+    []< typename... Ts >(Types< Ts... >)
+    {
+        (tuple_case< Ts >(), ...);
+    }(Elements{});
+}
@@ -0,0 +1,94 @@
+#include "parallel.hpp"
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace stct = static_containers;
+
+namespace
+{
+    /// Independent piece of state with a phase to run over it. Index only tells the types apart
+    /// and seeds the data
+    template < size_t I >
+    struct Subsystem
+    {
+        explicit Subsystem(size_t size):
+          data(size)
+        {
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                data[i] = static_cast< std::uint32_t >(i * 2654435761u + I);
+            }
+        }
+
+        std::uint64_t phase() const noexcept
+        {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (auto word: data)
+            {
+                hash = (hash ^ word) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        std::vector< std::uint32_t > data;
+    };
+
+    template < size_t... Is >
+    auto make_subsystems(size_t size, std::index_sequence< Is... >)
+    {
+        return stct::Tuple{ Subsystem< Is >(size)... };
+    }
+
+    void run_case(size_t size)
+    {
+        auto subsystems = make_subsystems(size, std::make_index_sequence< 8 >{});
+        const auto suffix = " <8 x " + std::to_string(size) + " words>";
+
+        BENCHMARK("sequential for_each" + suffix)
+        {
+            std::uint64_t result = 0;
+            stct::for_each(subsystems.view_full(),
+             [&](const auto & subsystem)
+             {
+                 result ^= subsystem.phase();
+             });
+            return result;
+        };
+
+        BENCHMARK("parallel_for_each" + suffix)
+        {
+            std::atomic< std::uint64_t > result = 0;
+            stct::parallel_for_each(subsystems.view_full(),
+             [&](const auto & subsystem)
+             {
+                 result ^= subsystem.phase();
+             });
+            return result.load();
+        };
+
+        BENCHMARK("parallel_transform" + suffix)
+        {
+            return stct::parallel_transform(subsystems.view_full(),
+             [](const auto & subsystem)
+             {
+                 return subsystem.phase();
+             });
+        };
+    }
+}
+
+TEST_CASE("parallel benchmarking")
+{
+    for (size_t size: { 256, 4096, 65536, 1048576 })
+    {
+        run_case(size);
+    }
+}
@@ -0,0 +1,149 @@
+#ifndef BENCH_PERF_COUNTERS_HPP
+#define BENCH_PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#define STCT_HAS_PERF_EVENTS 1
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define STCT_HAS_PERF_EVENTS 0
+#endif
+
+namespace static_containers::benchmarking
+{
+    /// Hardware counters of the calling thread. Every counter is opened on its own, so a counter
+    /// the kernel or the hypervisor refuses to provide is reported as missing instead of taking
+    /// the others down with it
+    class PerfCounters
+    {
+       public:
+        enum Event : size_t
+        {
+            Cycles,
+            Instructions,
+            BranchMisses,
+            CacheMisses,
+            L1dMisses,
+            EVENTS_COUNT,
+        };
+
+        using Readings = std::array< std::optional< std::uint64_t >, EVENTS_COUNT >;
+
+        PerfCounters() noexcept
+        {
+            fds_.fill(-1);
+#if STCT_HAS_PERF_EVENTS
+            constexpr std::uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D |
+                                                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            fds_[Cycles] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+            fds_[Instructions] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+            fds_[BranchMisses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+            fds_[CacheMisses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+            fds_[L1dMisses] = open(PERF_TYPE_HW_CACHE, l1d_read_miss);
+#endif
+        }
+
+        PerfCounters(const PerfCounters &) = delete;
+        PerfCounters & operator=(const PerfCounters &) = delete;
+
+        ~PerfCounters()
+        {
+#if STCT_HAS_PERF_EVENTS
+            for (int fd: fds_)
+            {
+                if (fd != -1)
+                {
+                    ::close(fd);
+                }
+            }
+#endif
+        }
+
+        static constexpr std::string_view name_of(Event event) noexcept
+        {
+            constexpr std::array< std::string_view, EVENTS_COUNT > names = {
+                "cycles",
+                "instructions",
+                "branch_misses",
+                "cache_misses",
+                "l1d_misses",
+            };
+            return names[event];
+        }
+
+        bool available() const noexcept
+        {
+            for (int fd: fds_)
+            {
+                if (fd != -1)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void start() noexcept
+        {
+#if STCT_HAS_PERF_EVENTS
+            for (int fd: fds_)
+            {
+                if (fd != -1)
+                {
+                    ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        Readings stop() noexcept
+        {
+            Readings result;
+#if STCT_HAS_PERF_EVENTS
+            for (size_t i = 0; i < EVENTS_COUNT; ++i)
+            {
+                if (fds_[i] == -1)
+                {
+                    continue;
+                }
+                ::ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+                std::uint64_t value = 0;
+                if (::read(fds_[i], &value, sizeof(value)) == sizeof(value))
+                {
+                    result[i] = value;
+                }
+            }
+#endif
+            return result;
+        }
+
+       private:
+#if STCT_HAS_PERF_EVENTS
+        static int open(std::uint32_t type, std::uint64_t config) noexcept
+        {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            return static_cast< int >(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+#endif
+
+        std::array< int, EVENTS_COUNT > fds_;
+    };
+}
+
+#endif
@@ -0,0 +1,183 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_version_macros.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "perf_counters.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    /// Where the report goes. Compare two of them with benchmarks/compare_counters.py
+    constexpr const char * REPORT_ENV = "STCT_PERF_JSON";
+    constexpr const char * DEFAULT_REPORT = "perf_counters.json";
+
+    /// Test case holding the empty benchmark whose counts are subtracted from all the others
+    constexpr const char * BASELINE_TEST = "perf counter baseline";
+
+#if CATCH_VERSION_MAJOR > 3 || (CATCH_VERSION_MAJOR == 3 && CATCH_VERSION_MINOR >= 5)
+    using BenchmarkStats = Catch::BenchmarkStats;
+#else
+    using BenchmarkStats = Catch::BenchmarkStats<>;
+#endif
+
+    struct Record
+    {
+        std::string name;
+        double mean_ns;
+        std::uint64_t runs;
+        bench::PerfCounters::Readings totals;
+    };
+
+    void write_escaped(std::ostream & out, const std::string & str)
+    {
+        out << '"';
+        for (char c: str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out << '\\';
+            }
+            out << c;
+        }
+        out << '"';
+    }
+
+    /// Counters run from benchmarkStarting to benchmarkEnded, as Catch offers no event in
+    /// between. That span also holds Catch's warmup and its bootstrap analysis of the samples,
+    /// whose cost depends on the configuration rather than on the benchmark body. The counts of
+    /// an empty benchmark, taken under the same configuration, are therefore subtracted from
+    /// every other benchmark before dividing by its samples * iterations runs
+    class PerfListener: public Catch::EventListenerBase
+    {
+       public:
+        using Catch::EventListenerBase::EventListenerBase;
+
+        void testCaseStarting(const Catch::TestCaseInfo & info) override
+        {
+            test_case_ = info.name;
+        }
+
+        void benchmarkPreparing(Catch::StringRef name) override
+        {
+            benchmark_ = std::string(name);
+        }
+
+        void benchmarkStarting(const Catch::BenchmarkInfo & info) override
+        {
+            runs_ = static_cast< std::uint64_t >(info.samples) *
+                    static_cast< std::uint64_t >(info.iterations);
+            counters_.start();
+        }
+
+        void benchmarkEnded(const BenchmarkStats & stats) override
+        {
+            auto readings = counters_.stop();
+            Record record{ test_case_ + "/" + benchmark_,
+                std::chrono::duration< double, std::nano >(stats.mean.point).count(),
+                runs_,
+                readings };
+            if (test_case_ == BASELINE_TEST)
+            {
+                baseline_ = record;
+                return;
+            }
+            records_.push_back(std::move(record));
+        }
+
+        void testRunEnded(const Catch::TestRunStats &) override
+        {
+            if (records_.empty())
+            {
+                return;
+            }
+            const char * path = std::getenv(REPORT_ENV);
+            std::ofstream out(path != nullptr ? path : DEFAULT_REPORT);
+            out << std::setprecision(17);
+            out << "{\n  \"counters_available\": " << (counters_.available() ? "true" : "false")
+                << ",\n  \"baseline_subtracted\": " << (baseline_ ? "true" : "false")
+                << ",\n  \"benchmarks\": [";
+            for (size_t i = 0; i < records_.size(); ++i)
+            {
+                const auto & record = records_[i];
+                out << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+                write_escaped(out, record.name);
+                out << ", \"runs\": " << record.runs << ", \"mean_ns\": " << record.mean_ns;
+                for (size_t event = 0; event < record.totals.size(); ++event)
+                {
+                    out << ", \""
+                        << bench::PerfCounters::name_of(static_cast< bench::PerfCounters::Event >(
+                            event))
+                        << "\": ";
+                    if (auto per_run = per_run_of(record, event))
+                    {
+                        out << *per_run;
+                    }
+                    else
+                    {
+                        out << "null";
+                    }
+                }
+                out << "}";
+            }
+            out << "\n  ]\n}\n";
+        }
+
+       private:
+        /// Reading of one event for a single run, the baseline taken off when there is one.
+        /// Noise may push a tiny body below the baseline, which reads as zero
+        std::optional< double > per_run_of(const Record & record, size_t event) const
+        {
+            const auto & total = record.totals[event];
+            if (!total || record.runs == 0)
+            {
+                return std::nullopt;
+            }
+            double count = static_cast< double >(*total);
+            if (baseline_)
+            {
+                const auto & offset = baseline_->totals[event];
+                if (!offset)
+                {
+                    return std::nullopt;
+                }
+                count = std::max(0.0, count - static_cast< double >(*offset));
+            }
+            return count / static_cast< double >(record.runs);
+        }
+
+        bench::PerfCounters counters_;
+        std::string test_case_;
+        std::string benchmark_;
+        std::uint64_t runs_ = 0;
+        std::vector< Record > records_;
+        std::optional< Record > baseline_;
+    };
+}
+
+CATCH_REGISTER_LISTENER(PerfListener)
+
+/// Runs under the same sample count and resamples as every other benchmark. Include it when
+/// filtering tests, or the report comes out with baseline_subtracted set to false
+TEST_CASE(BASELINE_TEST, "[perf_baseline]")
+{
+    BENCHMARK("empty body")
+    {
+        return 0;
+    };
+}
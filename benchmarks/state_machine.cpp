@@ -0,0 +1,313 @@
+#include "state_machine.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t EVENTS = 4096;
+
+    /// Connection life cycle: the same states, events and handlers for every engine
+    struct Closed
+    {};
+
+    struct Connecting
+    {
+        std::uint64_t peer;
+        std::uint64_t attempts;
+    };
+
+    struct Established
+    {
+        std::uint64_t peer;
+        std::uint64_t sent;
+    };
+
+    struct Connect
+    {
+        std::uint64_t peer;
+    };
+
+    struct Retry
+    {};
+
+    struct Accepted
+    {};
+
+    struct Send
+    {
+        std::uint64_t bytes;
+    };
+
+    struct Close
+    {};
+
+    template < template < typename... > typename VariantT >
+    std::vector< VariantT< Connect, Retry, Accepted, Send, Close > > make_events()
+    {
+        using Result = VariantT< Connect, Retry, Accepted, Send, Close >;
+        constexpr std::array< Result (*)(std::uint64_t), 5 > make = {
+            [](std::uint64_t i) -> Result
+            {
+                return Connect{ i };
+            },
+            [](std::uint64_t) -> Result
+            {
+                return Retry{};
+            },
+            [](std::uint64_t) -> Result
+            {
+                return Accepted{};
+            },
+            [](std::uint64_t i) -> Result
+            {
+                return Send{ i % 1500 };
+            },
+            [](std::uint64_t) -> Result
+            {
+                return Close{};
+            },
+        };
+        auto kinds = bench::make_indices(bench::Distribution::Uniform, make.size(), EVENTS);
+        std::vector< Result > result;
+        result.reserve(EVENTS);
+        for (size_t i = 0; i < EVENTS; ++i)
+        {
+            result.push_back(make[kinds[i]](i));
+        }
+        return result;
+    }
+
+    /// Classic State pattern: one class per state, a virtual member per event, and transitions
+    /// allocating the next state. A queue of mixed events still has to be decoded before the
+    /// virtual call, so every event costs two dispatches
+    class VirtualState
+    {
+       public:
+        virtual ~VirtualState() = default;
+
+        virtual std::unique_ptr< VirtualState > on(const Connect &)
+        {
+            return nullptr;
+        }
+
+        virtual std::unique_ptr< VirtualState > on(const Retry &)
+        {
+            return nullptr;
+        }
+
+        virtual std::unique_ptr< VirtualState > on(const Accepted &)
+        {
+            return nullptr;
+        }
+
+        virtual std::unique_ptr< VirtualState > on(const Send &)
+        {
+            return nullptr;
+        }
+
+        virtual std::unique_ptr< VirtualState > on(const Close &, std::uint64_t &)
+        {
+            return nullptr;
+        }
+    };
+
+    class VirtualClosed : public VirtualState
+    {
+       public:
+        std::unique_ptr< VirtualState > on(const Connect & event) override;
+        using VirtualState::on;
+    };
+
+    class VirtualConnecting : public VirtualState
+    {
+       public:
+        explicit VirtualConnecting(std::uint64_t peer):
+          state_{ peer, 1 }
+        {}
+
+        std::unique_ptr< VirtualState > on(const Retry &) override
+        {
+            ++state_.attempts;
+            return nullptr;
+        }
+
+        std::unique_ptr< VirtualState > on(const Accepted &) override;
+        using VirtualState::on;
+
+       private:
+        Connecting state_;
+    };
+
+    class VirtualEstablished : public VirtualState
+    {
+       public:
+        explicit VirtualEstablished(std::uint64_t peer):
+          state_{ peer, 0 }
+        {}
+
+        std::unique_ptr< VirtualState > on(const Send & event) override
+        {
+            state_.sent += event.bytes;
+            return nullptr;
+        }
+
+        std::unique_ptr< VirtualState > on(const Close &, std::uint64_t & total) override
+        {
+            total += state_.sent;
+            return std::make_unique< VirtualClosed >();
+        }
+
+        using VirtualState::on;
+
+       private:
+        Established state_;
+    };
+
+    std::unique_ptr< VirtualState > VirtualClosed::on(const Connect & event)
+    {
+        return std::make_unique< VirtualConnecting >(event.peer);
+    }
+
+    std::unique_ptr< VirtualState > VirtualConnecting::on(const Accepted &)
+    {
+        return std::make_unique< VirtualEstablished >(state_.peer);
+    }
+
+    /// std::visit over the state and the event, with a catch-all for unhandled pairs
+    struct StdStep
+    {
+        using State = std::variant< Closed, Connecting, Established >;
+
+        State & state;
+        std::uint64_t & total;
+
+        void operator()(Closed &, const Connect & event)
+        {
+            state = Connecting{ event.peer, 1 };
+        }
+
+        void operator()(Connecting & connecting, const Retry &)
+        {
+            ++connecting.attempts;
+        }
+
+        void operator()(Connecting & connecting, const Accepted &)
+        {
+            state = Established{ connecting.peer, 0 };
+        }
+
+        void operator()(Established & established, const Send & event)
+        {
+            established.sent += event.bytes;
+        }
+
+        void operator()(Established & established, const Close &)
+        {
+            total += established.sent;
+            state = Closed{};
+        }
+
+        void operator()(auto &, const auto &)
+        {}
+    };
+
+    auto make_machine(std::uint64_t & total)
+    {
+        return stct::make_state_machine< Closed, Connecting, Established >(
+         stct::on< Closed, Connect >(
+          [](Closed &, const Connect & event)
+          {
+              return Connecting{ event.peer, 1 };
+          }),
+         stct::on< Connecting, Retry >(
+          [](Connecting & connecting, const Retry &)
+          {
+              ++connecting.attempts;
+          }),
+         stct::on< Connecting, Accepted >(
+          [](Connecting & connecting, const Accepted &)
+          {
+              return Established{ connecting.peer, 0 };
+          }),
+         stct::on< Established, Send >(
+          [](Established & established, const Send & event)
+          {
+              established.sent += event.bytes;
+          }),
+         stct::on< Established, Close >(
+          [&total](Established & established, const Close &)
+          {
+              total += established.sent;
+              return Closed{};
+          }));
+    }
+}
+
+TEST_CASE("state machine benchmarking")
+{
+    const auto events = make_events< stct::Variant >();
+    const auto std_events = make_events< std::variant >();
+
+    BENCHMARK("virtual states")
+    {
+        std::uint64_t total = 0;
+        std::unique_ptr< VirtualState > state = std::make_unique< VirtualClosed >();
+        for (const auto & event: std_events)
+        {
+            auto next = std::visit(
+             [&](const auto & e)
+             {
+                 if constexpr (std::is_same_v< std::remove_cvref_t< decltype(e) >, Close >)
+                 {
+                     return state->on(e, total);
+                 }
+                 else
+                 {
+                     return state->on(e);
+                 }
+             },
+             event);
+            if (next != nullptr)
+            {
+                state = std::move(next);
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK("std::variant + std::visit")
+    {
+        std::uint64_t total = 0;
+        StdStep::State state;
+        for (const auto & event: std_events)
+        {
+            std::visit(StdStep{ state, total }, state, event);
+        }
+        return total;
+    };
+
+    BENCHMARK("StateMachine")
+    {
+        std::uint64_t total = 0;
+        auto machine = make_machine(total);
+        for (const auto & event: events)
+        {
+            machine.dispatch(event);
+        }
+        return total;
+    };
+}
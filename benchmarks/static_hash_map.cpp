@@ -0,0 +1,114 @@
+#include "static_hash_map.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t LOOKUPS = 4096;
+
+    /// Capacity which fills all 8192 slots up to the maximum load factor of 7/8
+    constexpr size_t CAPACITY = 7168;
+    using HashMap = stct::StaticHashMap< std::uint64_t, std::uint64_t, CAPACITY >;
+
+    /// Keys to insert, then a lookup stream hitting them half of the time
+    struct Workload
+    {
+        std::vector< std::uint64_t > keys;
+        std::vector< std::uint64_t > lookups;
+    };
+
+    Workload make_workload(size_t count)
+    {
+        std::mt19937_64 rng(bench::SEED);
+        Workload result;
+        for (size_t i = 0; i < count; ++i)
+        {
+            result.keys.push_back(rng());
+        }
+        auto picks = bench::make_indices(bench::Distribution::Uniform, count, LOOKUPS);
+        for (size_t i = 0; i < LOOKUPS; ++i)
+        {
+            result.lookups.push_back(i % 2 == 0 ? result.keys[picks[i]] : rng());
+        }
+        return result;
+    }
+
+    void run_case(size_t count, const char * load)
+    {
+        const auto workload = make_workload(count);
+        const auto suffix = std::string(" <load ") + load + ">";
+
+        auto map = std::make_unique< HashMap >();
+        std::unordered_map< std::uint64_t, std::uint64_t > std_map;
+        std_map.reserve(CAPACITY);
+        for (auto key: workload.keys)
+        {
+            (*map)[key] = key;
+            std_map[key] = key;
+        }
+
+        BENCHMARK("std::unordered_map find" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (auto key: workload.lookups)
+            {
+                auto it = std_map.find(key);
+                result += it == std_map.end() ? 1 : it->second;
+            }
+            return result;
+        };
+
+        BENCHMARK("StaticHashMap find" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (auto key: workload.lookups)
+            {
+                auto * value = map->find(key);
+                result += value == nullptr ? 1 : *value;
+            }
+            return result;
+        };
+
+        BENCHMARK("std::unordered_map erase + insert" + suffix)
+        {
+            for (size_t i = 0; i < LOOKUPS; ++i)
+            {
+                auto key = workload.keys[i % count];
+                std_map.erase(key);
+                std_map[key] = i;
+            }
+            return std_map.size();
+        };
+
+        BENCHMARK("StaticHashMap erase + insert" + suffix)
+        {
+            for (size_t i = 0; i < LOOKUPS; ++i)
+            {
+                auto key = workload.keys[i % count];
+                map->erase(key);
+                (*map)[key] = i;
+            }
+            return map->size();
+        };
+    }
+}
+
+TEST_CASE("static hash map benchmarking")
+{
+    run_case(HashMap::slot_count() / 2, "1/2");
+    run_case(HashMap::slot_count() * 3 / 4, "3/4");
+    run_case(HashMap::slot_count() * 7 / 8, "7/8");
+}
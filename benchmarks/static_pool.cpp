@@ -0,0 +1,144 @@
+#include "static_pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t SESSIONS = 1024;
+    constexpr size_t CHURN = 4096;
+
+    /// Stand-in for a protocol session: a couple of cache lines of state
+    struct Session
+    {
+        explicit Session(std::uint64_t id) noexcept:
+          id(id)
+        {}
+
+        std::uint64_t id;
+        std::array< std::uint64_t, 15 > state{};
+    };
+
+    struct NewDelete
+    {
+        Session * create(std::uint64_t id)
+        {
+            return new Session(id);
+        }
+
+        void destroy(Session * session) noexcept
+        {
+            delete session;
+        }
+    };
+
+    struct PmrPool
+    {
+        Session * create(std::uint64_t id)
+        {
+            return allocator.new_object< Session >(id);
+        }
+
+        void destroy(Session * session) noexcept
+        {
+            allocator.delete_object(session);
+        }
+
+        std::pmr::unsynchronized_pool_resource resource;
+        std::pmr::polymorphic_allocator<> allocator{ &resource };
+    };
+
+    template < template < typename, size_t > typename Pool >
+    struct Static : Pool< Session, SESSIONS >
+    {};
+
+    /// Keeps SESSIONS sessions alive, replacing one picked at random at every step
+    template < typename Arena >
+    std::uint64_t churn(
+     Arena & arena, std::vector< Session * > & live, const std::vector< size_t > & picks)
+    {
+        std::uint64_t result = 0;
+        for (size_t pick: picks)
+        {
+            result += live[pick]->id;
+            arena.destroy(live[pick]);
+            live[pick] = arena.create(result);
+        }
+        return result;
+    }
+
+    template < typename Arena >
+    void run_case(const char * name)
+    {
+        const auto picks = bench::make_indices(bench::Distribution::Uniform, SESSIONS, CHURN);
+        // make_unique would zero the whole static pool
+        std::unique_ptr< Arena > arena(new Arena);
+        std::vector< Session * > live;
+        for (size_t i = 0; i < SESSIONS; ++i)
+        {
+            live.push_back(arena->create(i));
+        }
+
+        BENCHMARK(std::string(name) + " <churn>")
+        {
+            return churn(*arena, live, picks);
+        };
+
+        for (Session * session: live)
+        {
+            arena->destroy(session);
+        }
+    }
+
+    template < typename List >
+    size_t fill_and_drain(List & list)
+    {
+        for (size_t i = 0; i < SESSIONS; ++i)
+        {
+            list.emplace_back(i);
+        }
+        size_t size = list.size();
+        list.clear();
+        return size;
+    }
+}
+
+TEST_CASE("static pool benchmarking")
+{
+    run_case< NewDelete >("new/delete");
+    run_case< PmrPool >("std::pmr::unsynchronized_pool_resource");
+    run_case< Static< stct::StaticPool > >("StaticPool");
+    run_case< Static< stct::AtomicStaticPool > >("AtomicStaticPool");
+
+    BENCHMARK("std::list with std::allocator")
+    {
+        std::list< Session > list;
+        return fill_and_drain(list);
+    };
+
+    std::pmr::unsynchronized_pool_resource resource;
+    BENCHMARK("std::pmr::list with std::pmr::unsynchronized_pool_resource")
+    {
+        std::pmr::list< Session > list(&resource);
+        return fill_and_drain(list);
+    };
+
+    BENCHMARK("std::list with StaticPoolAllocator")
+    {
+        std::list< Session, stct::StaticPoolAllocator< Session, SESSIONS > > list;
+        return fill_and_drain(list);
+    };
+}
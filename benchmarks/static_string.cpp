@@ -0,0 +1,69 @@
+#include "static_string.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t COMPARISONS = 4096;
+
+    /// Keys sharing long prefixes, so equal sizes are common and the content decides
+    std::vector< std::string > make_names(size_t length)
+    {
+        std::vector< std::string > names;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            std::string name(length, 'k');
+            name[length - 1] = static_cast< char >('a' + i % 26);
+            name[length / 2] = static_cast< char >('a' + i / 26);
+            names.push_back(name);
+        }
+        return names;
+    }
+
+    template < size_t N >
+    void run_case(size_t length)
+    {
+        const auto names = make_names(length);
+        const auto lhs = bench::make_keys(bench::Distribution::Uniform, names, COMPARISONS);
+        auto rhs = lhs;
+        std::vector< std::string >(rhs.rbegin(), rhs.rend()).swap(rhs);
+        const std::vector< stct::StaticString< N > > static_lhs(lhs.begin(), lhs.end());
+        const std::vector< stct::StaticString< N > > static_rhs(rhs.begin(), rhs.end());
+        const auto suffix = " <" + std::to_string(length) + " chars>";
+
+        BENCHMARK("std::string ==" + suffix)
+        {
+            size_t equal = 0;
+            for (size_t i = 0; i < COMPARISONS; ++i)
+            {
+                equal += lhs[i] == rhs[i];
+            }
+            return equal;
+        };
+
+        BENCHMARK("StaticString ==" + suffix)
+        {
+            size_t equal = 0;
+            for (size_t i = 0; i < COMPARISONS; ++i)
+            {
+                equal += static_lhs[i] == static_rhs[i];
+            }
+            return equal;
+        };
+    }
+}
+
+TEST_CASE("static string benchmarking")
+{
+    run_case< 15 >(12);
+    run_case< 47 >(40);
+}
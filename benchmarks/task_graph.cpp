@@ -0,0 +1,115 @@
+#include "task_graph.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace stct = static_containers;
+
+namespace
+{
+    /// FNV-1a over data, seeded so that every stage does distinct work
+    std::uint64_t hash(const std::vector< std::uint32_t > & data, std::uint64_t seed) noexcept
+    {
+        std::uint64_t result = 14695981039346656037ull ^ seed;
+        for (auto word: data)
+        {
+            result = (result ^ word) * 1099511628211ull;
+        }
+        return result;
+    }
+
+    std::vector< std::uint32_t > make_data(size_t size)
+    {
+        std::vector< std::uint32_t > data(size);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast< std::uint32_t >(i * 2654435761u);
+        }
+        return data;
+    }
+
+    void run_diamond(size_t size)
+    {
+        const auto data = make_data(size);
+        const auto suffix = " <diamond, " + std::to_string(size) + " words>";
+        auto source = [&]()
+        {
+            return hash(data, 0);
+        };
+        auto left = [&](std::uint64_t seed)
+        {
+            return hash(data, seed + 1);
+        };
+        auto right = [&](std::uint64_t seed)
+        {
+            return hash(data, seed + 2);
+        };
+        auto join = [&](std::uint64_t lhs, std::uint64_t rhs)
+        {
+            return hash(data, lhs ^ rhs);
+        };
+
+        BENCHMARK("sequential" + suffix)
+        {
+            auto seed = source();
+            return join(left(seed), right(seed));
+        };
+
+        auto graph = stct::make_task_graph(stct::stage<>(source), stct::stage< 0 >(left),
+         stct::stage< 0 >(right), stct::stage< 1, 2 >(join));
+        BENCHMARK("task graph" + suffix)
+        {
+            return get< 3 >(graph.run());
+        };
+    }
+
+    void run_fan_out(size_t size)
+    {
+        const auto data = make_data(size);
+        const auto suffix = " <fan out 8, " + std::to_string(size) + " words>";
+        auto source = [&]()
+        {
+            return hash(data, 0);
+        };
+        auto branch = [&](std::uint64_t salt)
+        {
+            return [&data, salt](std::uint64_t seed)
+            {
+                return hash(data, seed + salt);
+            };
+        };
+        auto join = [&](auto... branches)
+        {
+            return (branches ^ ...);
+        };
+
+        BENCHMARK("sequential" + suffix)
+        {
+            auto seed = source();
+            return join(branch(1)(seed), branch(2)(seed), branch(3)(seed), branch(4)(seed),
+             branch(5)(seed), branch(6)(seed), branch(7)(seed), branch(8)(seed));
+        };
+
+        auto graph = stct::make_task_graph(stct::stage<>(source), stct::stage< 0 >(branch(1)),
+         stct::stage< 0 >(branch(2)), stct::stage< 0 >(branch(3)), stct::stage< 0 >(branch(4)),
+         stct::stage< 0 >(branch(5)), stct::stage< 0 >(branch(6)), stct::stage< 0 >(branch(7)),
+         stct::stage< 0 >(branch(8)), stct::stage< 1, 2, 3, 4, 5, 6, 7, 8 >(join));
+        BENCHMARK("task graph" + suffix)
+        {
+            return get< 9 >(graph.run());
+        };
+    }
+}
+
+TEST_CASE("task graph benchmarking")
+{
+    for (size_t size: { 256, 4096, 65536, 1048576 })
+    {
+        run_diamond(size);
+        run_fan_out(size);
+    }
+}
@@ -0,0 +1,171 @@
+#include "variant.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t DISPATCHES = 1024;
+
+    /// Alternative telling its index apart, as collision shapes or message types do
+    template < size_t I >
+    struct Shape
+    {
+        std::uint32_t value;
+    };
+
+    /// Handler worth a distinct body for every combination
+    struct Collide
+    {
+        template < size_t... Is >
+        std::uint64_t operator()(const Shape< Is > &... shapes) const noexcept
+        {
+            std::uint64_t result = 0;
+            ((result = result * 31 + shapes.value * (Is + 1)), ...);
+            return result;
+        }
+    };
+
+    template < template < typename... > typename VariantT, size_t... Is >
+    auto make_variants(std::index_sequence< Is... >, size_t count, std::uint64_t seed)
+    {
+        using Result = VariantT< Shape< Is >... >;
+        constexpr std::array< Result (*)(std::uint32_t), sizeof...(Is) > make = {
+            [](std::uint32_t value)
+            {
+                return Result{ Shape< Is >{ value } };
+            }...
+        };
+        auto indices =
+         bench::make_indices(bench::Distribution::Uniform, sizeof...(Is), count + seed);
+        std::vector< Result > result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            result.push_back(make[indices[i + seed]](static_cast< std::uint32_t >(i)));
+        }
+        return result;
+    }
+
+    template < size_t ALTERNATIVES >
+    void run_pairs()
+    {
+        using Alternatives = std::make_index_sequence< ALTERNATIVES >;
+        const auto lhs = make_variants< stct::Variant >(Alternatives{}, DISPATCHES, 0);
+        const auto rhs = make_variants< stct::Variant >(Alternatives{}, DISPATCHES, 1);
+        const auto std_lhs = make_variants< std::variant >(Alternatives{}, DISPATCHES, 0);
+        const auto std_rhs = make_variants< std::variant >(Alternatives{}, DISPATCHES, 1);
+        const auto suffix = " <2 x " + std::to_string(ALTERNATIVES) + ">";
+
+        BENCHMARK("nested visit" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = 0; i < DISPATCHES; ++i)
+            {
+                result += stct::visit(lhs[i],
+                 [&](const auto & l)
+                 {
+                     return stct::visit(rhs[i],
+                      [&](const auto & r)
+                      {
+                          return Collide{}(l, r);
+                      });
+                 });
+            }
+            return result;
+        };
+
+        BENCHMARK("flat visit" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = 0; i < DISPATCHES; ++i)
+            {
+                result += stct::visit(Collide{}, lhs[i], rhs[i]);
+            }
+            return result;
+        };
+
+        BENCHMARK("std::visit" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = 0; i < DISPATCHES; ++i)
+            {
+                result += std::visit(Collide{}, std_lhs[i], std_rhs[i]);
+            }
+            return result;
+        };
+    }
+
+    template < size_t ALTERNATIVES >
+    void run_triples()
+    {
+        using Alternatives = std::make_index_sequence< ALTERNATIVES >;
+        const auto first = make_variants< stct::Variant >(Alternatives{}, DISPATCHES, 0);
+        const auto second = make_variants< stct::Variant >(Alternatives{}, DISPATCHES, 1);
+        const auto third = make_variants< stct::Variant >(Alternatives{}, DISPATCHES, 2);
+        const auto std_first = make_variants< std::variant >(Alternatives{}, DISPATCHES, 0);
+        const auto std_second = make_variants< std::variant >(Alternatives{}, DISPATCHES, 1);
+        const auto std_third = make_variants< std::variant >(Alternatives{}, DISPATCHES, 2);
+        const auto suffix = " <3 x " + std::to_string(ALTERNATIVES) + ">";
+
+        BENCHMARK("nested visit" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = 0; i < DISPATCHES; ++i)
+            {
+                result += stct::visit(first[i],
+                 [&](const auto & a)
+                 {
+                     return stct::visit(second[i],
+                      [&](const auto & b)
+                      {
+                          return stct::visit(third[i],
+                           [&](const auto & c)
+                           {
+                               return Collide{}(a, b, c);
+                           });
+                      });
+                 });
+            }
+            return result;
+        };
+
+        BENCHMARK("flat visit" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = 0; i < DISPATCHES; ++i)
+            {
+                result += stct::visit(Collide{}, first[i], second[i], third[i]);
+            }
+            return result;
+        };
+
+        BENCHMARK("std::visit" + suffix)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = 0; i < DISPATCHES; ++i)
+            {
+                result += std::visit(Collide{}, std_first[i], std_second[i], std_third[i]);
+            }
+            return result;
+        };
+    }
+}
+
+TEST_CASE("variant visit benchmarking")
+{
+    run_pairs< 8 >();
+    run_triples< 4 >();
+}
@@ -0,0 +1,120 @@
+#include "variant.hpp"
+#include "variant_vector.hpp"
+#include "vector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "workload.hpp"
+
+namespace stct = static_containers;
+namespace bench = stct::benchmarking;
+
+namespace
+{
+    constexpr size_t ELEMENTS = 1 << 20;
+
+    /// Alternatives of rather different sizes, as entities of a scene are
+    struct Particle
+    {
+        float energy;
+        float decay;
+    };
+
+    struct Body
+    {
+        std::array< float, 6 > state;
+    };
+
+    struct Emitter
+    {
+        std::array< std::uint64_t, 8 > seeds;
+    };
+
+    struct Update
+    {
+        std::uint64_t operator()(Particle & particle) const noexcept
+        {
+            particle.energy *= particle.decay;
+            return static_cast< std::uint64_t >(particle.energy);
+        }
+
+        std::uint64_t operator()(Body & body) const noexcept
+        {
+            body.state[0] += body.state[3];
+            body.state[1] += body.state[4];
+            body.state[2] += body.state[5];
+            return static_cast< std::uint64_t >(body.state[0]);
+        }
+
+        std::uint64_t operator()(Emitter & emitter) const noexcept
+        {
+            emitter.seeds[0] = emitter.seeds[0] * 6364136223846793005ull + 1442695040888963407ull;
+            return emitter.seeds[0] >> 60;
+        }
+    };
+
+    template < typename Add >
+    void fill(Add && add)
+    {
+        auto kinds = bench::make_indices(bench::Distribution::Uniform, 3, ELEMENTS);
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            auto seed = static_cast< float >(i % 97);
+            switch (kinds[i])
+            {
+            case 0:
+                add(Particle{ seed, 0.99f });
+                break;
+            case 1:
+                add(Body{ { seed, seed, seed, 0.5f, 0.25f, 0.125f } });
+                break;
+            default:
+                add(Emitter{ { i } });
+                break;
+            }
+        }
+    }
+}
+
+TEST_CASE("variant vector benchmarking")
+{
+    using VariantT = stct::Variant< Particle, Body, Emitter >;
+    using Mixed = stct::Vector< VariantT, ELEMENTS >;
+    using Segregated = stct::VariantVector< ELEMENTS, Particle, Body, Emitter >;
+
+    // default-initialized on the heap, as both are far too big for the stack
+    auto mixed = std::unique_ptr< Mixed >(new Mixed);
+    auto segregated = std::unique_ptr< Segregated >(new Segregated);
+    fill(
+     [&](auto element)
+     {
+         mixed->emplace_back(element);
+         segregated->push_back(element);
+     });
+
+    BENCHMARK("Vector<Variant> + visit <1M mixed>")
+    {
+        std::uint64_t result = 0;
+        for (auto & element: *mixed)
+        {
+            result += stct::visit(Update{}, element);
+        }
+        return result;
+    };
+
+    BENCHMARK("VariantVector::for_each <1M mixed>")
+    {
+        std::uint64_t result = 0;
+        segregated->for_each(
+         [&](auto & element)
+         {
+             result += Update{}(element);
+         });
+        return result;
+    };
+}
@@ -2,14 +2,43 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "workload.hpp"
 
 namespace stct = static_containers;
+namespace bench = stct::benchmarking;
 
 namespace
 {
-    auto vectorBenchmark(auto & vec)
+    constexpr size_t CAPACITY = 1000;
+    constexpr size_t FILLED = 500;
+    constexpr size_t OPERATIONS = 256;
+
+    /// Every insert is paired with an erase, so size stays at FILLED and positions generated for
+    /// it remain valid during the whole run
+    struct Positions
+    {
+        std::vector< size_t > insert;
+        std::vector< size_t > erase;
+    };
+
+    Positions make_positions(bench::Distribution distribution)
+    {
+        auto insert = bench::make_indices(distribution, FILLED + 1, OPERATIONS);
+        auto erase = bench::make_indices(distribution, FILLED + 1, OPERATIONS);
+        for (auto & pos: erase)
+        {
+            pos = pos == FILLED ? FILLED - 1 : pos;
+        }
+        return { std::move(insert), std::move(erase) };
+    }
+
+    auto vectorBenchmark(auto & vec, const Positions & positions)
     {
-        vec.assign(500, 10);
+        vec.assign(FILLED, 10);
         for (size_t i = 0; i < 250; ++i)
         {
             vec.push_back(10);
@@ -18,22 +47,42 @@ namespace
         {
             vec.pop_back();
         }
-        return vec.erase(vec.begin() + 123, vec.begin() + 322);
+        for (size_t i = 0; i < positions.insert.size(); ++i)
+        {
+            vec.insert(vec.begin() + positions.insert[i], 20);
+            vec.erase(vec.begin() + positions.erase[i]);
+        }
+        vec.erase(vec.begin() + 123, vec.begin() + 322);
+        return vec.size();
     }
 }
 
 TEST_CASE("vector benchmarking")
 {
-    BENCHMARK("std vector")
+    for (auto distribution: bench::distributions())
     {
-        std::vector< double > vec;
-        vec.reserve(1000);
-        return vectorBenchmark(vec);
-    };
+        const auto positions = make_positions(distribution);
+        const std::string suffix = " (" + std::string(bench::name_of(distribution)) + ")";
 
-    BENCHMARK("stct vector")
-    {
-        stct::Vector< double, 1000 > vec;
-        return vectorBenchmark(vec);
-    };
-}
\ No newline at end of file
+        BENCHMARK("std vector" + suffix)
+        {
+            std::vector< double > vec;
+            vec.reserve(CAPACITY);
+            return vectorBenchmark(vec, positions);
+        };
+
+        BENCHMARK("stct vector" + suffix)
+        {
+            stct::Vector< double, CAPACITY > vec;
+            return vectorBenchmark(vec, positions);
+        };
+
+        stct::testing::AllocationScope scope;
+        {
+            stct::Vector< double, CAPACITY > vec;
+            vectorBenchmark(vec, positions);
+        }
+        auto allocations = scope.allocations();
+        REQUIRE(allocations == 0);
+    }
+}
@@ -0,0 +1,213 @@
+#ifndef BENCH_WORKLOAD_HPP
+#define BENCH_WORKLOAD_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace static_containers::benchmarking
+{
+    /// Shape of an access stream. Every container in a benchmark is fed the very same stream, so
+    /// results stay comparable between them
+    enum class Distribution
+    {
+        Uniform,
+        Zipf,
+        Adversarial,
+        Trace,
+    };
+
+    /// Environment variable holding a path to a recorded trace: whitespace separated tokens, each
+    /// one being either a key or a plain index
+    constexpr const char * TRACE_ENV = "STCT_BENCH_TRACE";
+    constexpr std::uint64_t SEED = 0x5eed;
+    constexpr double ZIPF_SKEW = 1.0;
+
+    inline std::string_view name_of(Distribution distribution) noexcept
+    {
+        switch (distribution)
+        {
+        case Distribution::Uniform:
+            return "uniform";
+        case Distribution::Zipf:
+            return "zipf";
+        case Distribution::Adversarial:
+            return "adversarial";
+        case Distribution::Trace:
+            return "trace";
+        }
+        return "unknown";
+    }
+
+    inline std::vector< std::string > load_trace()
+    {
+        std::vector< std::string > tokens;
+        const char * path = std::getenv(TRACE_ENV);
+        if (path == nullptr)
+        {
+            return tokens;
+        }
+        std::ifstream in(path);
+        for (std::string token; in >> token;)
+        {
+            tokens.push_back(std::move(token));
+        }
+        return tokens;
+    }
+
+    /// Trace is only benchmarked when one was provided and it is not empty
+    inline std::vector< Distribution > distributions()
+    {
+        std::vector< Distribution > result = {
+            Distribution::Uniform,
+            Distribution::Zipf,
+            Distribution::Adversarial,
+        };
+        if (!load_trace().empty())
+        {
+            result.push_back(Distribution::Trace);
+        }
+        return result;
+    }
+
+    namespace detail
+    {
+        inline std::vector< size_t > uniform(size_t bound, size_t count, std::mt19937_64 & rng)
+        {
+            std::uniform_int_distribution< size_t > dist(0, bound - 1);
+            std::vector< size_t > result(count);
+            std::generate(result.begin(),
+             result.end(),
+             [&]()
+             {
+                 return dist(rng);
+             });
+            return result;
+        }
+
+        /// Popularity ranks are shuffled, so the hottest key is not always the smallest one
+        inline std::vector< size_t > zipf(size_t bound, size_t count, std::mt19937_64 & rng)
+        {
+            std::vector< double > cdf(bound);
+            double total = 0;
+            for (size_t rank = 0; rank < bound; ++rank)
+            {
+                total += 1.0 / std::pow(static_cast< double >(rank + 1), ZIPF_SKEW);
+                cdf[rank] = total;
+            }
+            std::vector< size_t > by_rank(bound);
+            std::iota(by_rank.begin(), by_rank.end(), 0);
+            std::shuffle(by_rank.begin(), by_rank.end(), rng);
+
+            std::uniform_real_distribution< double > dist(0, total);
+            std::vector< size_t > result(count);
+            std::generate(result.begin(),
+             result.end(),
+             [&]()
+             {
+                 auto rank = std::ranges::lower_bound(cdf, dist(rng)) - cdf.begin();
+                 return by_rank[std::min< size_t >(rank, bound - 1)];
+             });
+            return result;
+        }
+
+        /// Alternates between both ends of the range: binary searches flip direction on every
+        /// lookup and positional operations keep hitting the most expensive spot half of the time
+        inline std::vector< size_t > adversarial(size_t bound, size_t count)
+        {
+            std::vector< size_t > result(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t step = (i / 2) % ((bound + 1) / 2);
+                result[i] = i % 2 == 0 ? step : bound - 1 - step;
+            }
+            return result;
+        }
+
+        /// Tokens matching one of the keys map onto it, numeric tokens are taken modulo bound,
+        /// anything else is dropped
+        inline std::vector< size_t > trace(size_t bound,
+         size_t count,
+         const std::vector< std::string > & keys)
+        {
+            std::vector< size_t > result;
+            for (const auto & token: load_trace())
+            {
+                auto key = std::ranges::find(keys, token);
+                size_t idx = 0;
+                if (key != keys.end())
+                {
+                    result.push_back(key - keys.begin());
+                }
+                else if (std::from_chars(token.data(), token.data() + token.size(), idx).ec ==
+                         std::errc{})
+                {
+                    result.push_back(idx % bound);
+                }
+            }
+            if (result.empty())
+            {
+                return result;
+            }
+            for (size_t i = 0; result.size() < count; ++i)
+            {
+                result.push_back(result[i]);
+            }
+            result.resize(count);
+            return result;
+        }
+    }
+
+    /// count indices in [0, bound) shaped by distribution. keys are only consulted by a trace
+    inline std::vector< size_t > make_indices(Distribution distribution,
+     size_t bound,
+     size_t count,
+     const std::vector< std::string > & keys = {})
+    {
+        std::mt19937_64 rng(SEED);
+        switch (distribution)
+        {
+        case Distribution::Uniform:
+            return detail::uniform(bound, count, rng);
+        case Distribution::Zipf:
+            return detail::zipf(bound, count, rng);
+        case Distribution::Adversarial:
+            return detail::adversarial(bound, count);
+        case Distribution::Trace:
+            return detail::trace(bound, count, keys);
+        }
+        return {};
+    }
+
+    /// Key stream for lookups, materialized up front so that generation is not measured
+    template < typename Key >
+    std::vector< Key > make_keys(Distribution distribution,
+     const std::vector< Key > & keys,
+     size_t count)
+    {
+        std::vector< std::string > names;
+        if constexpr (std::is_convertible_v< Key, std::string >)
+        {
+            names.assign(keys.begin(), keys.end());
+        }
+        std::vector< Key > result;
+        result.reserve(count);
+        for (auto idx: make_indices(distribution, keys.size(), count, names))
+        {
+            result.push_back(keys[idx]);
+        }
+        return result;
+    }
+}
+
+#endif
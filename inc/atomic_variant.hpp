@@ -0,0 +1,197 @@
+#ifndef STCT_ATOMIC_VARIANT_HPP
+#define STCT_ATOMIC_VARIANT_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "tuple.hpp"
+#include "variant.hpp"
+
+namespace static_containers
+{
+    namespace detail
+    {
+        /// Seqlock over a trivially copyable T, for one writer and any number of readers. The
+        /// value is kept as relaxed atomic words, so a read racing with a write is merely retried
+        /// rather than undefined
+        template < typename T >
+        class SeqLock
+        {
+            static_assert(std::is_trivially_copyable_v< T >,
+             "Seqlock copies values bytewise, they must be trivially copyable");
+
+            using Word = std::uint64_t;
+            static constexpr size_t WORDS = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+            using Words = std::array< Word, WORDS >;
+
+           public:
+            explicit SeqLock(const T & value) noexcept
+            {
+                store(value);
+            }
+
+            SeqLock(const SeqLock &) = delete;
+            SeqLock & operator=(const SeqLock &) = delete;
+
+            /// Single attempt, so it never waits. Empty if a store was under way
+            std::optional< T > try_load() const noexcept
+            {
+                std::uint64_t before = sequence_.load(std::memory_order_acquire);
+                if (before % 2 != 0)
+                {
+                    return std::nullopt;
+                }
+                Words words;
+                for (size_t i = 0; i < WORDS; ++i)
+                {
+                    words[i] = data_[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence_.load(std::memory_order_relaxed) != before)
+                {
+                    return std::nullopt;
+                }
+                return from_words(words);
+            }
+
+            /// Retries until no store interferes. Never blocks the writer
+            T load() const noexcept
+            {
+                while (true)
+                {
+                    if (auto value = try_load())
+                    {
+                        return *value;
+                    }
+                    // the writer may be preempted mid-store, let it finish
+                    std::this_thread::yield();
+                }
+            }
+
+            /// Only ever called from one thread at a time
+            void store(const T & value) noexcept
+            {
+                Words words{};
+                std::memcpy(words.data(), std::addressof(value), sizeof(T));
+                std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+                sequence_.store(sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                for (size_t i = 0; i < WORDS; ++i)
+                {
+                    data_[i].store(words[i], std::memory_order_relaxed);
+                }
+                sequence_.store(sequence + 2, std::memory_order_release);
+            }
+
+           private:
+            static T from_words(const Words & words) noexcept
+            {
+                std::array< std::byte, sizeof(T) > bytes;
+                std::memcpy(bytes.data(), words.data(), sizeof(T));
+                return std::bit_cast< T >(bytes);
+            }
+
+            std::atomic< std::uint64_t > sequence_ = 0;
+            std::array< std::atomic< Word >, WORDS > data_;
+        };
+    }
+
+    /// Variant published by a single writer to any number of readers without locks. Readers get
+    /// a consistent copy, retrying while a store is under way
+    template < typename... Args >
+    class AtomicVariant
+    {
+       public:
+        using VariantT = Variant< Args... >;
+
+        static_assert(std::is_trivially_copyable_v< VariantT >,
+         "AtomicVariant needs trivially copyable alternatives");
+
+        AtomicVariant() noexcept:
+          lock_(VariantT{})
+        {}
+
+        explicit AtomicVariant(const VariantT & value) noexcept:
+          lock_(value)
+        {}
+
+        VariantT load() const noexcept
+        {
+            return lock_.load();
+        }
+
+        std::optional< VariantT > try_load() const noexcept
+        {
+            return lock_.try_load();
+        }
+
+        void store(const VariantT & value) noexcept
+        {
+            lock_.store(value);
+        }
+
+        template < size_t I, typename... Us >
+        void emplace(Us &&... us) noexcept
+        {
+            store(VariantT(std::in_place_index< I >, std::forward< Us >(us)...));
+        }
+
+        template < typename T, typename... Us >
+        void emplace(Us &&... us) noexcept
+        {
+            store(VariantT(std::in_place_type< T >, std::forward< Us >(us)...));
+        }
+
+       private:
+        detail::SeqLock< VariantT > lock_;
+    };
+
+    /// Tuple published the same way as AtomicVariant
+    template < typename... Args >
+    class AtomicTuple
+    {
+       public:
+        using TupleT = Tuple< Args... >;
+
+        static_assert(std::is_trivially_copyable_v< TupleT >,
+         "AtomicTuple needs trivially copyable elements");
+
+        explicit AtomicTuple(const TupleT & value) noexcept:
+          lock_(value)
+        {}
+
+        TupleT load() const noexcept
+        {
+            return lock_.load();
+        }
+
+        std::optional< TupleT > try_load() const noexcept
+        {
+            return lock_.try_load();
+        }
+
+        void store(const TupleT & value) noexcept
+        {
+            lock_.store(value);
+        }
+
+        template < typename... Us >
+        void emplace(Us &&... us) noexcept
+        {
+            store(TupleT(std::forward< Us >(us)...));
+        }
+
+       private:
+        detail::SeqLock< TupleT > lock_;
+    };
+}
+
+#endif
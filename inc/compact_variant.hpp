@@ -0,0 +1,260 @@
+#ifndef STCT_COMPACT_VARIANT_HPP
+#define STCT_COMPACT_VARIANT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "traits.hpp"
+#include "variant.hpp"
+
+namespace static_containers
+{
+    /// Bits which are zero in every valid value of T. Specialize with a SPARE_BITS member for types
+    /// which leave some unused, e.g. an enum of a few values over a wide underlying type
+    template < typename T >
+    struct NicheTraits
+    {};
+
+    /// Pointers to aligned objects never set their lowest bits
+    template < typename T >
+        requires std::is_object_v< T >
+    struct NicheTraits< T * >
+    {
+        static constexpr std::uint64_t SPARE_BITS = alignof(T) - 1;
+    };
+
+    /// Only 0 and 1 are valid representations of a bool
+    template <>
+    struct NicheTraits< bool >
+    {
+        static constexpr std::uint64_t SPARE_BITS = 0xfe;
+    };
+
+    namespace detail
+    {
+        template < size_t SIZE >
+        struct WordOf;
+
+        template <>
+        struct WordOf< 1 >
+        {
+            using type = std::uint8_t;
+        };
+
+        template <>
+        struct WordOf< 2 >
+        {
+            using type = std::uint16_t;
+        };
+
+        template <>
+        struct WordOf< 4 >
+        {
+            using type = std::uint32_t;
+        };
+
+        template <>
+        struct WordOf< 8 >
+        {
+            using type = std::uint64_t;
+        };
+
+        template < typename T >
+        concept NicheCandidate = std::is_trivially_copyable_v< T > &&
+         (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+        /// Spare bits of T once widened to 64 bits, where everything past T itself is spare
+        template < NicheCandidate T >
+        constexpr std::uint64_t spare_bits() noexcept
+        {
+            std::uint64_t spare = 0;
+            if constexpr (requires { NicheTraits< T >::SPARE_BITS; })
+            {
+                spare = NicheTraits< T >::SPARE_BITS;
+            }
+            if constexpr (sizeof(T) < sizeof(std::uint64_t))
+            {
+                spare |= ~std::uint64_t(0) << (8 * sizeof(T));
+            }
+            return spare;
+        }
+
+        /// Where CompactVariant keeps its index: the lowest run of bits spare in every alternative
+        template < typename... Args >
+        struct NicheLayout
+        {
+            static constexpr size_t WORD_SIZE = std::max({ sizeof(Args)... });
+            using Word = WordOf< WORD_SIZE >::type;
+
+            static constexpr std::uint64_t COMMON_SPARE =
+             (spare_bits< Args >() & ...) &
+             (~std::uint64_t(0) >> (64 - 8 * WORD_SIZE));
+            static constexpr unsigned TAG_BITS = std::bit_width(sizeof...(Args) - 1);
+
+            /// Shift of the index within a Word, or -1 if no run of TAG_BITS spare bits exists
+            static constexpr int SHIFT = []()
+            {
+                std::uint64_t tag = (std::uint64_t(1) << TAG_BITS) - 1;
+                for (unsigned shift = 0; shift + TAG_BITS <= 8 * WORD_SIZE; ++shift)
+                {
+                    if ((COMMON_SPARE & (tag << shift)) == tag << shift)
+                    {
+                        return static_cast< int >(shift);
+                    }
+                }
+                return -1;
+            }();
+
+            static constexpr Word TAG_MASK = static_cast< Word >(
+             ((std::uint64_t(1) << TAG_BITS) - 1) << (SHIFT < 0 ? 0 : SHIFT));
+        };
+    }
+
+    /// Variant of small trivially copyable alternatives which keeps its index in bits every
+    /// alternative leaves unused (see NicheTraits), so it is no bigger than the largest of them.
+    /// Alternatives live inside a tagged word, so they are read and written by value only
+    template < typename... Args >
+    class CompactVariant
+    {
+        static_assert((detail::NicheCandidate< Args > && ...),
+         "CompactVariant alternatives are trivially copyable and 1, 2, 4 or 8 bytes big");
+
+        using Layout = detail::NicheLayout< Args... >;
+        using Word = Layout::Word;
+
+        static_assert(Layout::SHIFT >= 0,
+         "Alternatives have too few spare bits in common to store the index, use Variant");
+
+       public:
+        constexpr CompactVariant() noexcept
+        {
+            emplace< 0 >();
+        }
+
+        template < typename T >
+            requires detail::OneOf< T, Args... >
+        constexpr CompactVariant(T val) noexcept
+        {
+            *this = val;
+        }
+
+        template < typename T >
+            requires detail::OneOf< T, Args... >
+        constexpr CompactVariant & operator=(T val) noexcept
+        {
+            emplace< find_where< T >() >(val);
+            return *this;
+        }
+
+        template < size_t I, typename... Us >
+        constexpr auto emplace(Us &&... us) noexcept
+        {
+            using T = ith< I, Args... >::type;
+            T value(std::forward< Us >(us)...);
+            using Bits = detail::WordOf< sizeof(T) >::type;
+            word_ = static_cast< Word >(static_cast< Word >(std::bit_cast< Bits >(value)) |
+             (static_cast< Word >(I) << Layout::SHIFT));
+            return value;
+        }
+
+        template < typename T, typename... Us >
+        constexpr T emplace(Us &&... us) noexcept
+        {
+            return emplace< find_where< T >() >(std::forward< Us >(us)...);
+        }
+
+        constexpr size_t index() const noexcept
+        {
+            return (word_ & Layout::TAG_MASK) >> Layout::SHIFT;
+        }
+
+        static constexpr size_t alternatives() noexcept
+        {
+            return sizeof...(Args);
+        }
+
+        template < typename U >
+        constexpr bool holds() const noexcept
+        {
+            return index() == find_where< U >();
+        }
+
+        template < size_t I >
+        constexpr auto at() const
+        {
+            if (index() != I)
+            {
+                throw std::bad_variant_access{};
+            }
+            return unchecked< I >();
+        }
+
+        template < typename U >
+        constexpr U at_t() const
+        {
+            return at< find_where< U >() >();
+        }
+
+        /// Alternative I, which must be the active one
+        template < size_t I >
+        constexpr auto unchecked() const noexcept
+        {
+            using T = ith< I, Args... >::type;
+            using Bits = detail::WordOf< sizeof(T) >::type;
+            return std::bit_cast< T >(static_cast< Bits >(word_ & ~Layout::TAG_MASK));
+        }
+
+        /// Same alternative with the same bits
+        constexpr bool operator==(const CompactVariant &) const noexcept = default;
+
+       private:
+        template < typename U >
+        static constexpr size_t find_where() noexcept
+        {
+            static_assert(detail::OneOf< U, Args... >, "Requested variant type is not present");
+            size_t i = 0;
+            ((std::is_same_v< U, Args > ? false : (++i, true)) && ...);
+            return i;
+        }
+
+        Word word_;
+    };
+
+    template < typename T, typename... Args >
+    constexpr T get(const CompactVariant< Args... > & var)
+    {
+        return var.template at_t< T >();
+    }
+
+    template < size_t I, typename... Args >
+    constexpr auto get(const CompactVariant< Args... > & var)
+    {
+        return var.template at< I >();
+    }
+
+    /// Calls f with a copy of the active alternative, through a jump table as visit over Variant
+    template < typename F, typename... Args >
+    auto visit(F && f, const CompactVariant< Args... > & var)
+    {
+        using VariantT = CompactVariant< Args... >;
+        using Result = std::common_type_t< std::invoke_result_t< F &, Args >... >;
+        static constexpr auto table = []< size_t... Is >(std::index_sequence< Is... >)
+        {
+            return std::array< Result (*)(F &, const VariantT &), sizeof...(Args) >{
+                [](F & f, const VariantT & var) -> Result
+                {
+                    return f(var.template unchecked< Is >());
+                }...
+            };
+        }(std::index_sequence_for< Args... >{});
+        return table[var.index()](f, var);
+    }
+}
+
+#endif
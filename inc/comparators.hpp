@@ -19,6 +19,15 @@ namespace static_containers
             T::template value< Lhs, Rhs >()
         } -> std::convertible_to< bool >;
     };
+
+    /// TypeComparator which orders types by a constexpr key, so sorting a pack needs one key per
+    /// type instead of a comparison per pair of types
+    template < typename T >
+    concept KeyedTypeComparator = requires {
+        {
+            T::compare_keys(T::template key< char >(), T::template key< char >())
+        } -> std::convertible_to< bool >;
+    };
 }
 
 namespace static_containers::comparators::size_of
@@ -26,10 +35,21 @@ namespace static_containers::comparators::size_of
     template < Comparator< size_t > Comparator, Comparator CMP = Comparator{} >
     struct compare
     {
+        template < typename T >
+        constexpr static size_t key() noexcept
+        {
+            return sizeof(T);
+        }
+
+        constexpr static bool compare_keys(size_t lhs, size_t rhs) noexcept
+        {
+            return CMP(lhs, rhs);
+        }
+
         template < typename T1, typename T2 >
         constexpr static bool value() noexcept
         {
-            return CMP(sizeof(T1), sizeof(T2));
+            return compare_keys(key< T1 >(), key< T2 >());
         }
     };
 
@@ -46,10 +66,21 @@ namespace static_containers::comparators::align_of
     template < Comparator< size_t > Comparator, Comparator CMP = Comparator{} >
     struct compare
     {
+        template < typename T >
+        constexpr static size_t key() noexcept
+        {
+            return alignof(T);
+        }
+
+        constexpr static bool compare_keys(size_t lhs, size_t rhs) noexcept
+        {
+            return CMP(lhs, rhs);
+        }
+
         template < typename T1, typename T2 >
         constexpr static bool value() noexcept
         {
-            return CMP(sizeof(T1), sizeof(T2));
+            return compare_keys(key< T1 >(), key< T2 >());
         }
     };
 
@@ -0,0 +1,129 @@
+#ifndef STCT_EVENT_BUS_HPP
+#define STCT_EVENT_BUS_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "parallel.hpp"
+#include "traits.hpp"
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+
+namespace static_containers
+{
+    namespace detail
+    {
+        /// Positions of the subscribers callable with an Event, in subscription order
+        template < typename Event, typename... Subscribers >
+        struct Accepting
+        {
+            static constexpr std::array< bool, sizeof...(Subscribers) > accepts = {
+                std::is_invocable_v< Subscribers &, const Event & >...
+            };
+
+            static constexpr size_t size =
+             (size_t(0) + ... + size_t(std::is_invocable_v< Subscribers &, const Event & >));
+
+            static constexpr std::array< size_t, size > indices = []()
+            {
+                std::array< size_t, size > result{};
+                size_t found = 0;
+                for (size_t i = 0; i < accepts.size(); ++i)
+                {
+                    if (accepts[i])
+                    {
+                        result[found++] = i;
+                    }
+                }
+                return result;
+            }();
+        };
+    }
+
+    /// Fixed set of subscribers, each a callable taking the events it cares about. Which of them
+    /// receive an event is settled at compile time from its type, so emit is a sequence of
+    /// direct calls
+    template < typename... Subscribers >
+    class EventBus
+    {
+       public:
+        constexpr explicit EventBus(Subscribers... subscribers):
+          subscribers_(std::move(subscribers)...)
+        {}
+
+        /// Calls every subscriber accepting Event, in subscription order
+        template < typename Event >
+        constexpr void emit(const Event & event)
+        {
+            if constexpr (subscribers_of< Event >() > 0)
+            {
+                for_each(accepting< Event >().view_full(),
+                 [&](auto & subscriber)
+                 {
+                     subscriber(event);
+                 });
+            }
+        }
+
+        /// Calls every subscriber accepting Event, each as a task on ThreadPool::instance(), and
+        /// returns once all of them are done. Subscribers are called concurrently, so they have
+        /// to be safe for that
+        template < typename Event >
+        void parallel_emit(const Event & event)
+        {
+            if constexpr (subscribers_of< Event >() > 0)
+            {
+                parallel_for_each(accepting< Event >().view_full(),
+                 [&](auto & subscriber)
+                 {
+                     subscriber(event);
+                 });
+            }
+        }
+
+        /// How many subscribers receive an Event
+        template < typename Event >
+        static constexpr size_t subscribers_of() noexcept
+        {
+            return detail::Accepting< Event, Subscribers... >::size;
+        }
+
+        template < size_t I >
+        constexpr auto & subscriber() noexcept
+        {
+            return subscribers_.template at< I >();
+        }
+
+        template < size_t I >
+        constexpr const auto & subscriber() const noexcept
+        {
+            return subscribers_.template at< I >();
+        }
+
+       private:
+        /// References to the subscribers accepting Event
+        template < typename Event >
+        constexpr auto accepting() noexcept
+        {
+            using Found = detail::Accepting< Event, Subscribers... >;
+            return [&]< size_t... Ks >(std::index_sequence< Ks... >)
+            {
+                return Tuple< typename ith< Found::indices[Ks], Subscribers... >::type &... >{
+                    subscribers_.template at< Found::indices[Ks] >()...
+                };
+            }(std::make_index_sequence< Found::size >{});
+        }
+
+        Tuple< Subscribers... > subscribers_;
+    };
+
+    template < typename... Subscribers >
+    constexpr auto make_event_bus(Subscribers... subscribers)
+    {
+        return EventBus< Subscribers... >{ std::move(subscribers)... };
+    }
+}
+
+#endif
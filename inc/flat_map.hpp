@@ -0,0 +1,515 @@
+#ifndef STCT_FLAT_MAP_HPP
+#define STCT_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace static_containers
+{
+    namespace detail
+    {
+        /// lower_bound whose loop does not branch on comparisons: the range halves every step
+        /// whatever the result, and picking the half compiles to a conditional move
+        template < typename K, typename Q, typename Compare >
+        size_t branchless_lower_bound(
+         const K * keys, size_t size, const Q & key, const Compare & cmp) noexcept
+        {
+            if (size == 0)
+            {
+                return 0;
+            }
+            const K * base = keys;
+            while (size > 1)
+            {
+                size_t half = size / 2;
+                base = cmp(base[half], key) ? base + half : base;
+                size -= half;
+            }
+            return static_cast< size_t >(base - keys) + cmp(*base, key);
+        }
+
+        /// Entry of a bulk insertion, remembering its place in the input so that the first of
+        /// equal keys wins
+        template < typename K, typename V >
+        struct Incoming
+        {
+            K key;
+            V value;
+            size_t order;
+        };
+
+        template < typename K >
+        struct Incoming< K, void >
+        {
+            K key;
+            size_t order;
+        };
+
+        /// Sorts incoming by key, then keeps only the first of equal keys and only the keys
+        /// missing from the sorted keys
+        template < typename K, typename V, size_t N, typename Compare >
+        void prepare_incoming(
+         Vector< Incoming< K, V >, N > & incoming, const Vector< K, N > & keys, const Compare & cmp)
+        {
+            std::sort(incoming.begin(),
+             incoming.end(),
+             [&](const auto & lhs, const auto & rhs)
+             {
+                 return cmp(lhs.key, rhs.key) ||
+                        (!cmp(rhs.key, lhs.key) && lhs.order < rhs.order);
+             });
+            size_t kept = 0;
+            size_t present = 0;
+            for (size_t i = 0; i < incoming.size(); ++i)
+            {
+                const K & key = incoming[i].key;
+                if (kept > 0 && !cmp(incoming[kept - 1].key, key))
+                {
+                    continue;
+                }
+                while (present < keys.size() && cmp(keys[present], key))
+                {
+                    ++present;
+                }
+                if (present < keys.size() && !cmp(key, keys[present]))
+                {
+                    continue;
+                }
+                if (kept != i)
+                {
+                    incoming[kept] = std::move(incoming[i]);
+                }
+                ++kept;
+            }
+            incoming.erase(incoming.begin() + kept, incoming.end());
+        }
+
+        /// Adds entry to incoming unless its key is in keys or among incoming[0, sorted), which
+        /// prepare_incoming left sorted. A full incoming is prepared again first, so that repeated
+        /// keys do not take up room. False if the key is new and does not fit beside keys
+        template < typename K, typename V, size_t N, typename Compare >
+        bool stage_incoming(Vector< Incoming< K, V >, N > & incoming,
+         size_t & sorted,
+         const Vector< K, N > & keys,
+         const Compare & cmp,
+         Incoming< K, V > && entry)
+        {
+            if (incoming.size() == N)
+            {
+                prepare_incoming(incoming, keys, cmp);
+                sorted = incoming.size();
+            }
+            size_t present = branchless_lower_bound(keys.data(), keys.size(), entry.key, cmp);
+            if (present < keys.size() && !cmp(entry.key, keys[present]))
+            {
+                return true;
+            }
+            auto staged = std::lower_bound(incoming.begin(),
+             incoming.begin() + sorted,
+             entry.key,
+             [&](const auto & lhs, const K & key)
+             {
+                 return cmp(lhs.key, key);
+             });
+            if (staged != incoming.begin() + sorted && !cmp(entry.key, staged->key))
+            {
+                return true;
+            }
+            if (sorted >= N - keys.size())
+            {
+                return false;
+            }
+            incoming.push_back(std::move(entry));
+            return true;
+        }
+    }
+
+    /// Sorted map of up to N entries, keys and values in two separate Vectors: a lookup only
+    /// walks the keys, and finds them with a branchless binary search
+    template < typename K, typename V, size_t N, typename Compare = std::less< K > >
+    class FlatMap
+    {
+       public:
+        using KeyType = K;
+        using MappedType = V;
+        using SizeType = size_t;
+
+        FlatMap() = default;
+
+        explicit FlatMap(Compare cmp):
+          cmp_(std::move(cmp))
+        {}
+
+        /// Value of key, nullptr if there is none
+        template < typename Q >
+        V * find(const Q & key) noexcept
+        {
+            size_t i = lower_bound(key);
+            return i < size() && !cmp_(key, keys_[i]) ? std::addressof(values_[i]) : nullptr;
+        }
+
+        template < typename Q >
+        const V * find(const Q & key) const noexcept
+        {
+            return const_cast< FlatMap & >(*this).find(key);
+        }
+
+        template < typename Q >
+        bool contains(const Q & key) const noexcept
+        {
+            return find(key) != nullptr;
+        }
+
+        /// Throws std::out_of_range if key is missing
+        template < typename Q >
+        V & at(const Q & key)
+        {
+            if (V * value = find(key))
+            {
+                return *value;
+            }
+            throw std::out_of_range("FlatMap has no such key");
+        }
+
+        template < typename Q >
+        const V & at(const Q & key) const
+        {
+            return const_cast< FlatMap & >(*this).at(key);
+        }
+
+        /// Position of the first key not less than key
+        template < typename Q >
+        size_t lower_bound(const Q & key) const noexcept
+        {
+            return detail::branchless_lower_bound(keys_.data(), size(), key, cmp_);
+        }
+
+        /// Value of key, constructed from args if key was missing. Throws std::length_error if it
+        /// was missing and the map is full
+        template < typename... Args >
+        std::pair< V *, bool > try_emplace(K key, Args &&... args)
+        {
+            size_t i = lower_bound(key);
+            if (i < size() && !cmp_(key, keys_[i]))
+            {
+                return { std::addressof(values_[i]), false };
+            }
+            if (size() == N)
+            {
+                throw std::length_error("FlatMap capacity exceeded");
+            }
+            values_.emplace(values_.begin() + i, std::forward< Args >(args)...);
+            keys_.emplace(keys_.begin() + i, std::move(key));
+            return { std::addressof(values_[i]), true };
+        }
+
+        template < typename U >
+        std::pair< V *, bool > insert_or_assign(K key, U && value)
+        {
+            auto result = try_emplace(std::move(key), std::forward< U >(value));
+            if (!result.second)
+            {
+                *result.first = std::forward< U >(value);
+            }
+            return result;
+        }
+
+        V & operator[](K key)
+        {
+            return *try_emplace(std::move(key)).first;
+        }
+
+        /// Inserts every (key, value) pair of [first, last) whose key is missing, the first of
+        /// equal keys winning as with one try_emplace after another. The new entries are sorted
+        /// on their own, then merged from the back in a single pass, so each existing entry
+        /// moves at most once. They are staged N at a time, dropping repeated keys whenever the
+        /// stage fills, so the input may be longer than N. Throws std::length_error, changing
+        /// nothing, if the new keys do not fit
+        template < std::input_iterator It >
+        void insert_range(It first, It last)
+        {
+            Vector< detail::Incoming< K, V >, N > incoming;
+            size_t sorted = 0;
+            for (size_t order = 0; first != last; ++first, ++order)
+            {
+                auto && [key, value] = *first;
+                if (!detail::stage_incoming(
+                     incoming, sorted, keys_, cmp_, { K(key), V(value), order }))
+                {
+                    throw std::length_error("FlatMap capacity exceeded");
+                }
+            }
+            detail::prepare_incoming(incoming, keys_, cmp_);
+            if (incoming.size() > N - size())
+            {
+                throw std::length_error("FlatMap capacity exceeded");
+            }
+
+            size_t old = size();
+            // grow by the number of new entries, then put those back aside for the merge
+            for (auto & entry: incoming)
+            {
+                keys_.push_back(std::move(entry.key));
+                values_.push_back(std::move(entry.value));
+            }
+            for (size_t j = 0; j < incoming.size(); ++j)
+            {
+                incoming[j].key = std::move(keys_[old + j]);
+                incoming[j].value = std::move(values_[old + j]);
+            }
+
+            size_t write = size();
+            for (size_t j = incoming.size(); j > 0;)
+            {
+                --write;
+                if (old > 0 && cmp_(incoming[j - 1].key, keys_[old - 1]))
+                {
+                    --old;
+                    keys_[write] = std::move(keys_[old]);
+                    values_[write] = std::move(values_[old]);
+                }
+                else
+                {
+                    --j;
+                    keys_[write] = std::move(incoming[j].key);
+                    values_[write] = std::move(incoming[j].value);
+                }
+            }
+        }
+
+        template < typename R >
+        void insert_range(R && range)
+        {
+            insert_range(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template < typename Q >
+        bool erase(const Q & key)
+        {
+            size_t i = lower_bound(key);
+            if (i == size() || cmp_(key, keys_[i]))
+            {
+                return false;
+            }
+            keys_.erase(keys_.begin() + i);
+            values_.erase(values_.begin() + i);
+            return true;
+        }
+
+        void clear() noexcept
+        {
+            keys_.clear();
+            values_.clear();
+        }
+
+        /// Calls f(key, value) for every entry, in key order
+        template < typename F >
+        void for_each(F && f)
+        {
+            for (size_t i = 0; i < size(); ++i)
+            {
+                f(std::as_const(keys_[i]), values_[i]);
+            }
+        }
+
+        template < typename F >
+        void for_each(F && f) const
+        {
+            for (size_t i = 0; i < size(); ++i)
+            {
+                f(keys_[i], values_[i]);
+            }
+        }
+
+        const Vector< K, N > & keys() const noexcept
+        {
+            return keys_;
+        }
+
+        Vector< V, N > & values() noexcept
+        {
+            return values_;
+        }
+
+        const Vector< V, N > & values() const noexcept
+        {
+            return values_;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return keys_.empty();
+        }
+
+        SizeType size() const noexcept
+        {
+            return keys_.size();
+        }
+
+        static constexpr SizeType capacity() noexcept
+        {
+            return N;
+        }
+
+       private:
+        Vector< K, N > keys_;
+        Vector< V, N > values_;
+        [[no_unique_address]] Compare cmp_;
+    };
+
+    /// Sorted set of up to N keys, searched and bulk-inserted as FlatMap does
+    template < typename K, size_t N, typename Compare = std::less< K > >
+    class FlatSet
+    {
+       public:
+        using KeyType = K;
+        using SizeType = size_t;
+
+        FlatSet() = default;
+
+        explicit FlatSet(Compare cmp):
+          cmp_(std::move(cmp))
+        {}
+
+        template < typename Q >
+        bool contains(const Q & key) const noexcept
+        {
+            size_t i = lower_bound(key);
+            return i < size() && !cmp_(key, keys_[i]);
+        }
+
+        template < typename Q >
+        size_t lower_bound(const Q & key) const noexcept
+        {
+            return detail::branchless_lower_bound(keys_.data(), size(), key, cmp_);
+        }
+
+        /// False if key was there already. Throws std::length_error if it was not and the set is
+        /// full
+        bool insert(K key)
+        {
+            size_t i = lower_bound(key);
+            if (i < size() && !cmp_(key, keys_[i]))
+            {
+                return false;
+            }
+            if (size() == N)
+            {
+                throw std::length_error("FlatSet capacity exceeded");
+            }
+            keys_.emplace(keys_.begin() + i, std::move(key));
+            return true;
+        }
+
+        /// Same as FlatMap::insert_range
+        template < std::input_iterator It >
+        void insert_range(It first, It last)
+        {
+            Vector< detail::Incoming< K, void >, N > incoming;
+            size_t sorted = 0;
+            for (size_t order = 0; first != last; ++first, ++order)
+            {
+                if (!detail::stage_incoming(incoming, sorted, keys_, cmp_, { K(*first), order }))
+                {
+                    throw std::length_error("FlatSet capacity exceeded");
+                }
+            }
+            detail::prepare_incoming(incoming, keys_, cmp_);
+            if (incoming.size() > N - size())
+            {
+                throw std::length_error("FlatSet capacity exceeded");
+            }
+
+            size_t old = size();
+            for (auto & entry: incoming)
+            {
+                keys_.push_back(std::move(entry.key));
+            }
+            for (size_t j = 0; j < incoming.size(); ++j)
+            {
+                incoming[j].key = std::move(keys_[old + j]);
+            }
+
+            size_t write = size();
+            for (size_t j = incoming.size(); j > 0;)
+            {
+                --write;
+                if (old > 0 && cmp_(incoming[j - 1].key, keys_[old - 1]))
+                {
+                    keys_[write] = std::move(keys_[--old]);
+                }
+                else
+                {
+                    keys_[write] = std::move(incoming[--j].key);
+                }
+            }
+        }
+
+        template < typename R >
+        void insert_range(R && range)
+        {
+            insert_range(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template < typename Q >
+        bool erase(const Q & key)
+        {
+            size_t i = lower_bound(key);
+            if (i == size() || cmp_(key, keys_[i]))
+            {
+                return false;
+            }
+            keys_.erase(keys_.begin() + i);
+            return true;
+        }
+
+        void clear() noexcept
+        {
+            keys_.clear();
+        }
+
+        /// Keys in order
+        const Vector< K, N > & keys() const noexcept
+        {
+            return keys_;
+        }
+
+        auto begin() const noexcept
+        {
+            return keys_.begin();
+        }
+
+        auto end() const noexcept
+        {
+            return keys_.end();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return keys_.empty();
+        }
+
+        SizeType size() const noexcept
+        {
+            return keys_.size();
+        }
+
+        static constexpr SizeType capacity() noexcept
+        {
+            return N;
+        }
+
+       private:
+        Vector< K, N > keys_;
+        [[no_unique_address]] Compare cmp_;
+    };
+}
+
+#endif
@@ -1,193 +1,122 @@
+#ifndef STCT_FWD_HPP
+#define STCT_FWD_HPP
+
+#include <array>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include "tuple.hpp"
 #include "comparators.hpp"
+#include "traits.hpp"
 
 namespace static_containers
 {
+    /// Calls f with the arguments at positions Is, in that order. Arguments are forwarded through
+    /// one tuple of references, so reordering copies nothing. An argument may be left out; passing
+    /// an rvalue twice is up to the caller
+    template < size_t... Is, typename F, typename... Args >
+    constexpr decltype(auto) fwd_permuted(F && f, Args &&... args)
+    {
+        static_assert(((Is < sizeof...(Args)) && ...),
+         "Requested argument index is out of bounds");
+        auto refs = static_containers::forward_as_tuple(std::forward< Args >(args)...);
+        return std::forward< F >(f)(get< Is >(std::move(refs))...);
+    }
+
     namespace detail
     {
-        template < size_t FROM, size_t UNTIL, size_t I = 0, typename... Ordered >
-        struct FwdSlicedImpl
+        /// fwd_permuted with indices computed as a constexpr array
+        template < auto INDICES, typename F, typename... Args >
+        constexpr decltype(auto) fwd_by_table(F && f, Args &&... args)
         {
-            template < typename F, typename FirstUnordered, typename... Unordered >
-            constexpr static auto fwd(F && f,
-             Ordered &&... ordered,
-             FirstUnordered && to_order,
-             Unordered &&... unordered)
+            return [&]< size_t... Ks >(std::index_sequence< Ks... >) -> decltype(auto)
             {
-                if constexpr (I == UNTIL)
-                {
-                    return f(std::forward< Ordered >(ordered)...);
-                }
-                else if constexpr (I < FROM)
-                {
-                    return FwdSlicedImpl< FROM, UNTIL, I + 1, Ordered... >::fwd(
-                     std::forward< F >(f),
-                     std::forward< Ordered >(ordered)...,
-                     std::forward< Unordered >(unordered)...);
-                }
-                else
-                {
-                    return FwdSlicedImpl< FROM, UNTIL, I + 1, Ordered..., FirstUnordered >::fwd(
-                     std::forward< F >(f),
-                     std::forward< Ordered >(ordered)...,
-                     std::forward< FirstUnordered >(to_order),
-                     std::forward< Unordered >(unordered)...);
-                }
-            }
+                return fwd_permuted< INDICES[Ks]... >(std::forward< F >(f),
+                 std::forward< Args >(args)...);
+            }(std::make_index_sequence< INDICES.size() >{});
+        }
+    }
 
-            template < typename F >
-            constexpr static auto fwd(F && f, Ordered &&... ordered)
+    template < typename F, typename... Args >
+    constexpr decltype(auto) fwd_reversed(F && f, Args &&... args)
+    {
+        constexpr auto indices = []()
+        {
+            std::array< size_t, sizeof...(Args) > result{};
+            for (size_t i = 0; i < result.size(); ++i)
             {
-                static_assert(I == UNTIL);
-                return f(std::forward< Ordered >(ordered)...);
+                result[i] = result.size() - 1 - i;
             }
-        };
+            return result;
+        }();
+        return detail::fwd_by_table< indices >(std::forward< F >(f), std::forward< Args >(args)...);
     }
 
     template < size_t FROM, size_t UNTIL, typename F, typename... Args >
-    constexpr auto fwd_sliced(F && f, Args &&... args)
+    constexpr decltype(auto) fwd_sliced(F && f, Args &&... args)
     {
         static_assert(FROM <= UNTIL,
          "UNTIL idx should be greater then FROM idx or equal to FROM idx");
-        return detail::FwdSlicedImpl< FROM, UNTIL >::fwd(std::forward< F >(f),
-         std::forward< Args >(args)...);
+        static_assert(UNTIL <= sizeof...(Args), "Requested slice is out of bounds");
+        constexpr auto indices = []()
+        {
+            std::array< size_t, UNTIL - FROM > result{};
+            for (size_t i = 0; i < result.size(); ++i)
+            {
+                result[i] = FROM + i;
+            }
+            return result;
+        }();
+        return detail::fwd_by_table< indices >(std::forward< F >(f), std::forward< Args >(args)...);
     }
 
     template < size_t UNTIL, typename F, typename... Args >
-    constexpr auto fwd_first(F && f, Args &&... args)
+    constexpr decltype(auto) fwd_first(F && f, Args &&... args)
     {
         return fwd_sliced< 0, UNTIL >(std::forward< F >(f), std::forward< Args >(args)...);
     }
 
     template < size_t FROM, typename F, typename... Args >
-    constexpr auto fwd_last(F && f, Args &&... args)
+    constexpr decltype(auto) fwd_last(F && f, Args &&... args)
     {
         return fwd_sliced< FROM, sizeof...(Args) >(std::forward< F >(f),
          std::forward< Args >(args)...);
     }
 
-    namespace detail
-    {
-        template < size_t DESIRED, size_t I = 0, typename F, typename FirstArg, typename... Args >
-        constexpr auto fwd_ith_impl(F && f, FirstArg && arg, Args &&... args)
-        {
-            if constexpr (I == DESIRED)
-            {
-                return f(std::forward< FirstArg >(arg));
-            }
-            else
-            {
-                return fwd_ith_impl< DESIRED, I + 1 >(std::forward< F >(f),
-                 std::forward< Args >(args)...);
-            }
-        }
-    }
-
     template < size_t I, typename F, typename... Args >
-    constexpr auto fwd_ith(F f, Args &&... args)
-    {
-        return detail::fwd_ith_impl< I, 0, F, Args... >(std::forward< F >(f),
-         std::forward< Args >(args)...);
-    }
-
-    namespace detail
+    constexpr decltype(auto) fwd_ith(F && f, Args &&... args)
     {
-        template < size_t I, size_t J, typename... OriginalTypelist >
-        struct FwdSwappedImpl
-        {
-            static_assert(I < J);
-
-            template < typename F, typename... Args >
-            constexpr static auto fwd(F && f, Args &&... args)
-            {
-                auto begining = fwd_sliced< 0, I >(make_tuple, std::forward< Args >(args)...);
-                auto i = fwd_ith< I >(make_tuple, std::forward< Args >(args)...);
-                auto middle = fwd_sliced< I + 1, J >(make_tuple, std::forward< Args >(args)...);
-                auto j = fwd_ith< J >(make_tuple, std::forward< Args >(args)...);
-                auto ending =
-                 fwd_sliced< J + 1, sizeof...(Args) >(make_tuple, std::forward< Args >(args)...);
-                auto swapped_arglist = concat(begining, j, middle, i, ending);
-                return unwrap_then_do(std::forward< F >(f), std::move(swapped_arglist));
-            }
-        };
+        return fwd_permuted< I >(std::forward< F >(f), std::forward< Args >(args)...);
     }
 
     template < size_t I, size_t J, typename F, typename... Args >
-    constexpr auto fwd_swapped(F && f, Args &&... args)
+    constexpr decltype(auto) fwd_swapped(F && f, Args &&... args)
     {
-        return detail::FwdSwappedImpl< I, J, Args... >::fwd(std::forward< F >(f),
-         std::forward< Args >(args)...);
-    }
-
-    namespace detail
-    {
-        template < size_t N, size_t I, typename TypeComparator, typename... Passed >
-        struct FwdSortedImpl
+        static_assert(I < sizeof...(Args) && J < sizeof...(Args),
+         "Requested argument index is out of bounds");
+        constexpr auto indices = []()
         {
-            template < typename F,
-             typename FirstUnpassed,
-             typename SecondUnpassed,
-             typename... Unpassed >
-            constexpr static auto fwd(F && f,
-             Passed &&... passed,
-             FirstUnpassed && to_pass1,
-             SecondUnpassed && to_pass2,
-             Unpassed &&... unpassed)
-            {
-                if constexpr (!TypeComparator::template value< decltype(to_pass1),
-                               decltype(to_pass2) >())
-                {
-                    return FwdSortedImpl< N, I, TypeComparator, Passed..., SecondUnpassed >::fwd(
-                     std::forward< F >(f),
-                     std::forward< Passed >(passed)...,
-                     std::forward< SecondUnpassed >(to_pass2),
-                     std::forward< FirstUnpassed >(to_pass1),
-                     std::forward< Unpassed >(unpassed)...);
-                }
-                else
-                {
-                    return FwdSortedImpl< N, I, TypeComparator, Passed..., FirstUnpassed >::fwd(
-                     std::forward< F >(f),
-                     std::forward< Passed >(passed)...,
-                     std::forward< FirstUnpassed >(to_pass1),
-                     std::forward< SecondUnpassed >(to_pass2),
-                     std::forward< Unpassed >(unpassed)...);
-                }
-            }
-
-            template < typename F, typename FirstUnpassed >
-            constexpr static auto fwd(F && f, Passed &&... passed, FirstUnpassed && to_pass)
+            std::array< size_t, sizeof...(Args) > result{};
+            for (size_t i = 0; i < result.size(); ++i)
             {
-                return FwdSortedImpl< N, I, TypeComparator, Passed..., FirstUnpassed >::fwd(
-                 std::forward< F >(f),
-                 std::forward< Passed >(passed)...,
-                 std::forward< FirstUnpassed >(to_pass));
+                result[i] = i;
             }
-
-            template < typename F >
-            constexpr static auto fwd(F && f, Passed &&... passed)
-            {
-                if constexpr (I == N)
-                {
-                    return f(std::forward< Passed >(passed)...);
-                }
-                else
-                {
-                    return FwdSortedImpl< N, I + 1, TypeComparator >::fwd(std::forward< F >(f),
-                     std::forward< Passed >(passed)...);
-                }
-            }
-        };
+            std::swap(result[I], result[J]);
+            return result;
+        }();
+        return detail::fwd_by_table< indices >(std::forward< F >(f), std::forward< Args >(args)...);
     }
 
+    /// Calls f with args stably sorted by TypeComparator. The order is computed by a constexpr
+    /// merge sort (see pack::sorted)
     template < typename TypeComparator, typename F, typename... Args >
-    constexpr auto fwd_sorted(F && f, Args &&... args)
+    constexpr decltype(auto) fwd_sorted(F && f, Args &&... args)
     {
-        return detail::FwdSortedImpl< sizeof...(Args), 0, TypeComparator >::fwd(
-         std::forward< F >(f),
-         std::forward< Args >(args)...);
+        constexpr auto & order =
+         detail::sorted_order_v< TypeComparator, std::remove_cvref_t< Args >... >;
+        return detail::fwd_by_table< order >(std::forward< F >(f), std::forward< Args >(args)...);
     }
-}
\ No newline at end of file
+}
+
+#endif
@@ -0,0 +1,245 @@
+#ifndef STCT_INDIRECT_HPP
+#define STCT_INDIRECT_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "static_pool.hpp"
+#include "tuple.hpp"
+
+namespace static_containers
+{
+    /// Default number of objects an Indirect pool holds
+    constexpr size_t INDIRECT_POOL_CAPACITY = 64;
+
+    namespace detail
+    {
+        /// StaticPool behind a lock, keeping track of how many objects it ever held at once
+        template < typename T, size_t N >
+        class IndirectPool
+        {
+           public:
+            IndirectPool() noexcept = default;
+
+            IndirectPool(const IndirectPool &) = delete;
+            IndirectPool & operator=(const IndirectPool &) = delete;
+
+            /// Throws std::bad_alloc once all N objects are taken
+            template < typename... Us >
+            T * create(Us &&... us)
+            {
+                void * slot = take();
+                try
+                {
+                    return ::new (slot) T(std::forward< Us >(us)...);
+                }
+                catch (...)
+                {
+                    give_back(slot);
+                    throw;
+                }
+            }
+
+            void destroy(T * ptr) noexcept
+            {
+                std::destroy_at(ptr);
+                give_back(ptr);
+            }
+
+            static constexpr size_t capacity() noexcept
+            {
+                return N;
+            }
+
+            size_t in_use() const noexcept
+            {
+                std::lock_guard lock(mutex_);
+                return pool_.in_use();
+            }
+
+            /// Most objects alive at once so far
+            size_t high_water_mark() const noexcept
+            {
+                std::lock_guard lock(mutex_);
+                return high_water_;
+            }
+
+           private:
+            void * take()
+            {
+                std::lock_guard lock(mutex_);
+                void * slot = pool_.allocate();
+                high_water_ = std::max(high_water_, pool_.in_use());
+                return slot;
+            }
+
+            void give_back(void * slot) noexcept
+            {
+                std::lock_guard lock(mutex_);
+                pool_.deallocate(slot);
+            }
+
+            mutable std::mutex mutex_;
+            size_t high_water_ = 0;
+            StaticPool< T, N > pool_;
+        };
+    }
+
+    /// Owning handle to a T kept out of line in a static pool shared by all Indirect< T, N >. Meant
+    /// for big, rarely used alternatives: Variant stores the handle, while get and visit see T.
+    /// Moving steals the T and leaves no value behind: a copy of the moved-from Indirect has none
+    /// either, and reaching it throws std::bad_variant_access as an inactive alternative does
+    template < typename T, size_t N = INDIRECT_POOL_CAPACITY >
+    class Indirect
+    {
+       public:
+        using ValueType = T;
+        using Pool = detail::IndirectPool< T, N >;
+
+        template < typename... Us >
+            requires(detail::NotSelf< Indirect, Us... > && std::constructible_from< T, Us && ... >)
+        explicit Indirect(Us &&... us):
+          ptr_(pool().create(std::forward< Us >(us)...))
+        {}
+
+        Indirect(const Indirect & rhs):
+          ptr_(rhs.ptr_ == nullptr ? nullptr : pool().create(*rhs.ptr_))
+        {}
+
+        Indirect(Indirect && rhs) noexcept:
+          ptr_(std::exchange(rhs.ptr_, nullptr))
+        {}
+
+        Indirect & operator=(const Indirect & rhs)
+        {
+            if (rhs.ptr_ == nullptr)
+            {
+                if (ptr_ != nullptr)
+                {
+                    pool().destroy(std::exchange(ptr_, nullptr));
+                }
+            }
+            else if (ptr_ == nullptr)
+            {
+                ptr_ = pool().create(*rhs.ptr_);
+            }
+            else
+            {
+                *ptr_ = *rhs.ptr_;
+            }
+            return *this;
+        }
+
+        Indirect & operator=(Indirect && rhs) noexcept
+        {
+            std::swap(ptr_, rhs.ptr_);
+            return *this;
+        }
+
+        /// Assigns value to the T held, or creates a T from it if moved from
+        template < typename U >
+            requires std::same_as< std::remove_cvref_t< U >, T >
+        Indirect & operator=(U && value)
+        {
+            if (ptr_ == nullptr)
+            {
+                ptr_ = pool().create(std::forward< U >(value));
+            }
+            else
+            {
+                *ptr_ = std::forward< U >(value);
+            }
+            return *this;
+        }
+
+        ~Indirect()
+        {
+            if (ptr_ != nullptr)
+            {
+                pool().destroy(ptr_);
+            }
+        }
+
+        /// Throws std::bad_variant_access if moved from
+        T & get()
+        {
+            if (ptr_ == nullptr)
+            {
+                throw std::bad_variant_access{};
+            }
+            return *ptr_;
+        }
+
+        const T & get() const
+        {
+            return const_cast< Indirect & >(*this).get();
+        }
+
+        /// Whether this was moved from, or copied from an Indirect which was
+        bool valueless_after_move() const noexcept
+        {
+            return ptr_ == nullptr;
+        }
+
+        static Pool & pool() noexcept
+        {
+            static Pool instance;
+            return instance;
+        }
+
+       private:
+        T * ptr_;
+    };
+
+    namespace detail
+    {
+        template < typename T >
+        struct Unboxed
+        {
+            using type = T;
+        };
+
+        template < typename T, size_t N >
+        struct Unboxed< Indirect< T, N > >
+        {
+            using type = T;
+        };
+
+        /// Type an alternative is seen as: T for Indirect< T >, the alternative itself otherwise
+        template < typename T >
+        using UnboxedT = Unboxed< T >::type;
+
+        template < typename T >
+        constexpr T & unbox(T & value) noexcept
+        {
+            return value;
+        }
+
+        template < typename T >
+        constexpr const T & unbox(const T & value) noexcept
+        {
+            return value;
+        }
+
+        template < typename T, size_t N >
+        T & unbox(Indirect< T, N > & value)
+        {
+            return value.get();
+        }
+
+        template < typename T, size_t N >
+        const T & unbox(const Indirect< T, N > & value)
+        {
+            return value.get();
+        }
+    }
+}
+
+#endif
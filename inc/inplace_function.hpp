@@ -0,0 +1,219 @@
+#ifndef STCT_INPLACE_FUNCTION_HPP
+#define STCT_INPLACE_FUNCTION_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace static_containers
+{
+    /// Default room an InplaceFunction has for its callable: a few captured pointers
+    constexpr size_t INPLACE_FUNCTION_CAPACITY = 3 * sizeof(void *);
+
+    template < typename Signature, size_t CAPACITY = INPLACE_FUNCTION_CAPACITY >
+    class InplaceFunction;
+
+    namespace detail
+    {
+        template < typename T >
+        struct IsInplaceFunction : std::false_type
+        {};
+
+        template < typename Signature, size_t CAPACITY >
+        struct IsInplaceFunction< InplaceFunction< Signature, CAPACITY > > : std::true_type
+        {};
+
+        /// Callables which may be moved with memcpy and dropped without a destructor call
+        template < typename F >
+        concept TriviallyRelocatable =
+         std::is_trivially_copyable_v< F > && std::is_trivially_destructible_v< F >;
+    }
+
+    /// Move-only type-erased callable kept entirely inside the object: no allocation ever happens,
+    /// and a callable bigger than CAPACITY is a compile error. A call costs one indirect call.
+    /// Trivially copyable callables are moved with memcpy, everything else goes through a single
+    /// manager function
+    template < typename R, typename... Args, size_t CAPACITY >
+    class InplaceFunction< R(Args...), CAPACITY >
+    {
+        using Invoke = R (*)(void *, Args &&...);
+
+        /// Moves the callable from src into dst then destroys src, or destroys dst if src is null
+        using Manage = void (*)(void * dst, void * src) noexcept;
+
+       public:
+        constexpr InplaceFunction() noexcept = default;
+
+        constexpr InplaceFunction(std::nullptr_t) noexcept
+        {}
+
+        template < typename F >
+            requires(!detail::IsInplaceFunction< std::decay_t< F > >::value &&
+                     std::is_invocable_r_v< R, std::decay_t< F > &, Args... >)
+        InplaceFunction(F && f)
+        {
+            using Fn = std::decay_t< F >;
+            static_assert(sizeof(Fn) <= CAPACITY,
+             "Callable does not fit into InplaceFunction, raise its capacity");
+            static_assert(alignof(Fn) <= alignof(std::max_align_t),
+             "Callable is overaligned for InplaceFunction");
+            static_assert(std::is_nothrow_move_constructible_v< Fn >,
+             "InplaceFunction moves its callable, which must not throw doing so");
+
+            if constexpr (std::is_pointer_v< Fn > || std::is_member_pointer_v< Fn >)
+            {
+                if (f == nullptr)
+                {
+                    return;
+                }
+            }
+            ::new (static_cast< void * >(storage_)) Fn(std::forward< F >(f));
+            invoke_ = &invoke< Fn >;
+            if constexpr (!detail::TriviallyRelocatable< Fn >)
+            {
+                manage_ = &manage< Fn >;
+            }
+        }
+
+        InplaceFunction(InplaceFunction && rhs) noexcept
+        {
+            take(rhs);
+        }
+
+        InplaceFunction & operator=(InplaceFunction && rhs) noexcept
+        {
+            if (this != std::addressof(rhs))
+            {
+                reset();
+                take(rhs);
+            }
+            return *this;
+        }
+
+        InplaceFunction & operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        template < typename F >
+            requires(!detail::IsInplaceFunction< std::decay_t< F > >::value &&
+                     std::is_invocable_r_v< R, std::decay_t< F > &, Args... >)
+        InplaceFunction & operator=(F && f)
+        {
+            return *this = InplaceFunction(std::forward< F >(f));
+        }
+
+        InplaceFunction(const InplaceFunction &) = delete;
+        InplaceFunction & operator=(const InplaceFunction &) = delete;
+
+        ~InplaceFunction()
+        {
+            reset();
+        }
+
+        /// Throws std::bad_function_call if empty
+        R operator()(Args... args)
+        {
+            return invoke_(storage_, std::forward< Args >(args)...);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return invoke_ != &invoke_empty;
+        }
+
+        friend bool operator==(const InplaceFunction & f, std::nullptr_t) noexcept
+        {
+            return !f;
+        }
+
+        static constexpr size_t capacity() noexcept
+        {
+            return CAPACITY;
+        }
+
+        void swap(InplaceFunction & rhs) noexcept
+        {
+            InplaceFunction tmp(std::move(rhs));
+            rhs = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+       private:
+        template < typename Fn >
+        static R invoke(void * storage, Args &&... args)
+        {
+            Fn & fn = *std::launder(static_cast< Fn * >(storage));
+            if constexpr (std::is_void_v< R >)
+            {
+                // a callable returning something may stand for one returning nothing
+                std::invoke(fn, std::forward< Args >(args)...);
+            }
+            else
+            {
+                return std::invoke(fn, std::forward< Args >(args)...);
+            }
+        }
+
+        static R invoke_empty(void *, Args &&...)
+        {
+            throw std::bad_function_call{};
+        }
+
+        template < typename Fn >
+        static void manage(void * dst, void * src) noexcept
+        {
+            if (src == nullptr)
+            {
+                std::destroy_at(std::launder(static_cast< Fn * >(dst)));
+                return;
+            }
+            Fn * from = std::launder(static_cast< Fn * >(src));
+            ::new (dst) Fn(std::move(*from));
+            std::destroy_at(from);
+        }
+
+        /// Relocates the callable of rhs here, this being empty, and leaves rhs empty
+        void take(InplaceFunction & rhs) noexcept
+        {
+            if (rhs.manage_ == nullptr)
+            {
+                std::memcpy(storage_, rhs.storage_, CAPACITY);
+            }
+            else
+            {
+                rhs.manage_(storage_, rhs.storage_);
+            }
+            invoke_ = std::exchange(rhs.invoke_, &invoke_empty);
+            manage_ = std::exchange(rhs.manage_, nullptr);
+        }
+
+        void reset() noexcept
+        {
+            if (manage_ != nullptr)
+            {
+                manage_(storage_, nullptr);
+            }
+            invoke_ = &invoke_empty;
+            manage_ = nullptr;
+        }
+
+        Invoke invoke_ = &invoke_empty;
+        Manage manage_ = nullptr;
+        alignas(std::max_align_t) std::byte storage_[CAPACITY];
+    };
+
+    template < typename Signature, size_t CAPACITY >
+    void swap(InplaceFunction< Signature, CAPACITY > & lhs,
+     InplaceFunction< Signature, CAPACITY > & rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
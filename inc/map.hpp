@@ -27,33 +27,23 @@ namespace static_containers
             } -> std::convertible_to< bool >;
         };
 
-        template < bool isconst, size_t I = 0, typename F, typename... Values >
+        template < size_t I, typename F, typename ValuesT >
+        constexpr auto visit_one(F & f, ValuesT & values)
+        {
+            return f(get< I >(values));
+        }
+
+        /// One entry per value, so dispatch is a single indirect call and instantiation depth does
+        /// not grow with the number of keys
+        template < typename F, typename ValuesT, size_t... Is >
         constexpr auto visit_at_impl(size_t idx,
-         F f,
-         std::conditional_t< isconst, const Tuple< Values... > &, Tuple< Values... > & > values)
+         F & f,
+         ValuesT & values,
+         std::index_sequence< Is... >)
         {
-            if constexpr (I < sizeof...(Values) - 1)
-            {
-                switch (idx)
-                {
-                case I:
-                    return f(get< I >(values));
-                default:
-                    return visit_at_impl< isconst, I + 1, F, Values... >(idx,
-                     std::forward< F >(f),
-                     values);
-                }
-            }
-            else if constexpr (I == sizeof...(Values) - 1)
-            {
-                switch (idx)
-                {
-                case I:
-                    return f(get< I >(values));
-                default:
-                    assert(false);
-                }
-            }
+            constexpr std::array table = { &visit_one< Is, F, ValuesT >... };
+            assert(idx < table.size());
+            return table[idx](f, values);
         }
     }
 
@@ -76,17 +66,19 @@ namespace static_containers
         template < typename F >
         constexpr auto visit_at(const Key & key, F f)
         {
-            return detail::visit_at_impl< false, 0, F, Values... >(idx(key),
-             std::forward< F >(f),
-             values_);
+            return detail::visit_at_impl(idx(key),
+             f,
+             values_,
+             std::index_sequence_for< Values... >{});
         }
 
         template < typename F >
         constexpr auto visit_at(const Key & key, F f) const
         {
-            return detail::visit_at_impl< true, 0, F, Values... >(idx(key),
-             std::forward< F >(f),
-             values_);
+            return detail::visit_at_impl(idx(key),
+             f,
+             values_,
+             std::index_sequence_for< Values... >{});
         }
 
         constexpr size_t idx(const Key & key) const
@@ -113,7 +105,7 @@ namespace static_containers
 
        private:
         std::array< Key, sizeof...(Values) > keys_;
-        Tuple< Values... > values_;
+        [[no_unique_address]] Tuple< Values... > values_;
     };
 
     template < typename Key,
@@ -0,0 +1,201 @@
+#ifndef STCT_PACKED_TUPLE_HPP
+#define STCT_PACKED_TUPLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "comparators.hpp"
+#include "traits.hpp"
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+
+namespace static_containers
+{
+    namespace detail
+    {
+        template < typename Pack >
+        struct TupleOfPack;
+
+        template < typename... Args >
+        struct TupleOfPack< pack< Args... > >
+        {
+            using type = Tuple< Args... >;
+        };
+
+        /// Physical placement of PackedTuple elements: descending alignment leaves no padding
+        /// between them, since every size is a multiple of its own alignment
+        template < typename... Args >
+        struct PackedLayout
+        {
+            using comparator = comparators::align_of::greater;
+
+            /// physical_of[I] is where the logical element I is stored
+            static constexpr std::array< size_t, sizeof...(Args) > physical_of = []()
+            {
+                constexpr auto & order = sorted_order_v< comparator, Args... >;
+                std::array< size_t, sizeof...(Args) > result{};
+                for (size_t i = 0; i < order.size(); ++i)
+                {
+                    result[order[i]] = i;
+                }
+                return result;
+            }();
+
+            using Storage =
+             TupleOfPack< typename pack< Args... >::template sorted< comparator > >::type;
+
+            /// Storage built from constructor arguments given in the declared order
+            template < typename... Us >
+            static constexpr Storage make_storage(Us &&... us)
+            {
+                constexpr auto & order = sorted_order_v< comparator, Args... >;
+                ArgRefs< std::index_sequence_for< Us... >, Us... > refs{ { std::forward< Us >(
+                 us) }... };
+                return [&]< size_t... Ps >(std::index_sequence< Ps... >)
+                {
+                    return Storage{ arg_at< order[Ps] >(refs)... };
+                }(std::index_sequence_for< Args... >{});
+            }
+
+            /// Sum of sizes rounded up to the strictest alignment: no more than the reordered
+            /// elements need. Leaves may take less, reusing the tail padding of a non-POD member
+            static constexpr size_t minimal_size() noexcept
+            {
+                size_t size = (sizeof(Args) + ... + 0);
+                size_t align = std::max({ size_t(1), alignof(Args)... });
+                return std::max(size_t(1), (size + align - 1) / align * align);
+            }
+        };
+    }
+
+    /// Tuple which stores its elements reordered by descending alignment, so it takes no more
+    /// space than its members need. Indices, comparison and views keep the declared order
+    template < typename... Args >
+    class PackedTuple
+    {
+        static_assert(!(std::is_reference_v< Args > || ...),
+         "PackedTuple stores values only, use Tuple for references");
+
+        using Layout = detail::PackedLayout< Args... >;
+
+       public:
+        using args_as_pack = pack< Args... >;
+
+        constexpr PackedTuple(const Args &... args):
+          storage_(Layout::make_storage(args...))
+        {}
+
+        template < typename... Us >
+            requires(sizeof...(Us) == sizeof...(Args) && sizeof...(Args) > 0 &&
+                     detail::NotSelf< PackedTuple, Us... > &&
+                     (std::constructible_from< Args, Us && > && ...))
+        constexpr PackedTuple(Us &&... us):
+          storage_(Layout::make_storage(std::forward< Us >(us)...))
+        {}
+
+        PackedTuple(const PackedTuple &) = default;
+        PackedTuple(PackedTuple &&) = default;
+        PackedTuple & operator=(const PackedTuple &) = default;
+        PackedTuple & operator=(PackedTuple &&) = default;
+
+        template < size_t I >
+        constexpr auto & at()
+        {
+            static_assert(I < sizeof...(Args), "Requested tuple index is out of bounds");
+            return storage_.template at< Layout::physical_of[I] >();
+        }
+
+        template < size_t I >
+        constexpr const auto & at() const
+        {
+            static_assert(I < sizeof...(Args), "Requested tuple index is out of bounds");
+            return storage_.template at< Layout::physical_of[I] >();
+        }
+
+        static constexpr size_t size() noexcept
+        {
+            return sizeof...(Args);
+        }
+
+        /// Position at which the element I is actually stored
+        static constexpr size_t physical_index(size_t i) noexcept
+        {
+            return Layout::physical_of[i];
+        }
+
+        constexpr BasicTupleView< 0, sizeof...(Args), PackedTuple > view_full() noexcept
+        {
+            return { *this };
+        }
+
+        template < size_t BEGIN_IDX, size_t END_IDX >
+        constexpr BasicTupleView< BEGIN_IDX, END_IDX, PackedTuple > view() noexcept
+        {
+            return view_full()
+             .template shrink_front< BEGIN_IDX >()
+             .template shrink_back< size() - END_IDX >();
+        }
+
+        constexpr bool operator==(const PackedTuple & rhs) const
+        {
+            return [&]< size_t... Is >(std::index_sequence< Is... >)
+            {
+                return ((at< Is >() == rhs.template at< Is >()) && ...);
+            }(std::index_sequence_for< Args... >{});
+        }
+
+        /// Lexicographic in the declared order, same as Tuple
+        constexpr auto operator<=>(const PackedTuple & rhs) const
+        {
+            using Ordering = std::common_comparison_category_t<
+             std::compare_three_way_result_t< Args >... >;
+            Ordering result = Ordering::equivalent;
+            [&]< size_t... Is >(std::index_sequence< Is... >)
+            {
+                ((result = at< Is >() <=> rhs.template at< Is >(), result == 0) && ...);
+            }(std::index_sequence_for< Args... >{});
+            return result;
+        }
+
+       private:
+        typename Layout::Storage storage_;
+
+        /// Empty members may need a byte of their own when they cannot share an address
+        static_assert((std::is_empty_v< Args > || ...) ||
+                       sizeof(typename Layout::Storage) <= Layout::minimal_size(),
+         "Reordered elements still leave padding");
+    };
+
+    template < typename... Args >
+    PackedTuple(Args...) -> PackedTuple< Args... >;
+
+    template < size_t I, typename... Args >
+    constexpr auto & get(PackedTuple< Args... > & rhs)
+    {
+        return rhs.template at< I >();
+    }
+
+    template < size_t I, typename... Args >
+    constexpr const auto & get(const PackedTuple< Args... > & rhs)
+    {
+        return rhs.template at< I >();
+    }
+
+    template < size_t I, typename... Args >
+    constexpr auto && get(PackedTuple< Args... > && rhs)
+    {
+        return std::move(rhs.template at< I >());
+    }
+
+    constexpr auto make_packed_tuple = []< typename... Args >(Args &&... args)
+    {
+        return PackedTuple< std::decay_t< Args >... >{ std::forward< Args >(args)... };
+    };
+}
+
+#endif
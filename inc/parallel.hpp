@@ -0,0 +1,139 @@
+#ifndef STCT_PARALLEL_HPP
+#define STCT_PARALLEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "thread_pool.hpp"
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+
+namespace static_containers
+{
+    /// Default cutoff, under which every element goes to the pool: the size of an element says
+    /// nothing of the work a call on it does. A caller who knows its small elements are cheap may
+    /// pass a size in bytes instead, elements smaller than that then run on the calling thread
+    constexpr size_t PARALLEL_CUTOFF = 0;
+
+    namespace detail
+    {
+        template < size_t I, typename View >
+        using ElementOf = std::remove_cvref_t< decltype(get< I >(std::declval< View & >())) >;
+
+        template < size_t I, typename View, typename F >
+        using ResultOf = decltype(std::declval< F & >()(get< I >(std::declval< View & >())));
+
+        /// Where a result waits until all of them are ready
+        template < size_t I, typename View, typename F >
+        using SlotOf = std::optional< std::decay_t< ResultOf< I, View, F > > >;
+
+        template < typename View, typename F >
+        struct ForEachState
+        {
+            template < size_t I >
+            void run()
+            {
+                f(get< I >(view));
+            }
+
+            View & view;
+            F & f;
+        };
+
+        template < typename View, typename F, typename Slots >
+        struct TransformState
+        {
+            template < size_t I >
+            void run()
+            {
+                slots.template at< I >().emplace(f(get< I >(view)));
+            }
+
+            View & view;
+            F & f;
+            Slots & slots;
+        };
+
+        template < size_t I, typename State >
+        void run_element(void * state)
+        {
+            static_cast< State * >(state)->template run< I >();
+        }
+
+        /// One job per element of view: those of CUTOFF bytes or more go to the pool first, then
+        /// the smaller ones run here while the workers are busy
+        template < size_t CUTOFF, typename View, typename State >
+        void fork_join(State & state)
+        {
+            [&]< size_t... Is >(std::index_sequence< Is... >)
+            {
+                constexpr std::array< bool, View::size() > inline_run = {
+                    (View::size() == 1 || sizeof(ElementOf< Is, View >) < CUTOFF)...
+                };
+                std::array< TaskGroup::Job, View::size() > jobs = {
+                    TaskGroup::Job{ &run_element< Is, State >, &state }...
+                };
+
+                TaskGroup group;
+                for (size_t i = 0; i < jobs.size(); ++i)
+                {
+                    if (!inline_run[i])
+                    {
+                        group.run(jobs[i]);
+                    }
+                }
+                for (size_t i = 0; i < jobs.size(); ++i)
+                {
+                    if (inline_run[i])
+                    {
+                        group.run_inline(jobs[i]);
+                    }
+                }
+                group.wait();
+            }(std::make_index_sequence< View::size() >{});
+        }
+    }
+
+    /// for_each with one task per element on ThreadPool::instance(), except elements smaller than
+    /// CUTOFF bytes. f is called concurrently, so it has to be safe for that. The first exception
+    /// f throws is rethrown once all calls are over
+    template < size_t CUTOFF = PARALLEL_CUTOFF,
+     typename F,
+     size_t BEGIN,
+     size_t END,
+     typename TupleT >
+    void parallel_for_each(BasicTupleView< BEGIN, END, TupleT > view, F f)
+    {
+        using View = BasicTupleView< BEGIN, END, TupleT >;
+        detail::ForEachState< View, F > state{ view, f };
+        detail::fork_join< CUTOFF, View >(state);
+    }
+
+    /// Tuple of f applied to every element of view, computed as parallel_for_each does
+    template < size_t CUTOFF = PARALLEL_CUTOFF,
+     typename F,
+     size_t BEGIN,
+     size_t END,
+     typename TupleT >
+    auto parallel_transform(BasicTupleView< BEGIN, END, TupleT > view, F f)
+    {
+        using View = BasicTupleView< BEGIN, END, TupleT >;
+        return [&]< size_t... Is >(std::index_sequence< Is... >)
+        {
+            static_assert(!(std::is_void_v< detail::ResultOf< Is, View, F > > || ...),
+             "parallel_transform needs a result for every element, use parallel_for_each");
+            using Results = Tuple< std::decay_t< detail::ResultOf< Is, View, F > >... >;
+            using Slots = Tuple< detail::SlotOf< Is, View, F >... >;
+
+            Slots slots{ detail::SlotOf< Is, View, F >{}... };
+            detail::TransformState< View, F, Slots > state{ view, f, slots };
+            detail::fork_join< CUTOFF, View >(state);
+            return Results{ std::move(*get< Is >(slots))... };
+        }(std::make_index_sequence< View::size() >{});
+    }
+}
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef STCT_STATE_MACHINE_HPP
+#define STCT_STATE_MACHINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "tuple.hpp"
+#include "variant.hpp"
+
+namespace static_containers
+{
+    /// Handler f for Event arriving in State. f(state, event) returns either nothing, to stay in
+    /// State, or the next state
+    template < typename State, typename Event, typename F >
+    struct Transition
+    {
+        using StateT = State;
+        using EventT = Event;
+
+        F f;
+    };
+
+    template < typename State, typename Event, typename F >
+    constexpr Transition< State, Event, F > on(F f)
+    {
+        return { std::move(f) };
+    }
+
+    namespace detail
+    {
+        template < typename T >
+        struct IsTransition : std::false_type
+        {};
+
+        template < typename State, typename Event, typename F >
+        struct IsTransition< Transition< State, Event, F > > : std::true_type
+        {};
+
+        template < typename T >
+        concept AnyTransition = IsTransition< T >::value;
+
+        template < typename T, typename VariantT >
+        struct IsAlternativeOf : std::false_type
+        {};
+
+        template < typename T, typename... Ts >
+        struct IsAlternativeOf< T, Variant< Ts... > > : std::bool_constant< OneOf< T, Ts... > >
+        {};
+
+        /// Every transition leaves one of the alternatives of StatesT
+        template < typename StatesT, typename... Transitions >
+        concept TransitionsFrom =
+         (IsAlternativeOf< typename Transitions::StateT, StatesT >::value && ...);
+
+        /// Number of Transitions on the same state and event as T
+        template < typename T, typename... Transitions >
+        constexpr size_t TRANSITION_COUNT =
+         ((std::is_same_v< typename T::StateT, typename Transitions::StateT > &&
+           std::is_same_v< typename T::EventT, typename Transitions::EventT >) +
+          ... + 0);
+
+        /// No two transitions leave the same state on the same event
+        template < typename... Transitions >
+        concept DistinctTransitions =
+         ((TRANSITION_COUNT< Transitions, Transitions... > == 1) && ...);
+    }
+
+    /// States are the alternatives of a Variant, events are plain types and transitions are
+    /// looked up at compile time. Dispatch is one call through a table indexed by the current
+    /// state and, for a Variant of events, the event together. The state left is destroyed and
+    /// the next one constructed in its place
+    template < typename StatesT, typename... Transitions >
+    class StateMachine;
+
+    template < typename... States, typename... Transitions >
+    class StateMachine< Variant< States... >, Transitions... >
+    {
+        static constexpr size_t NO_TRANSITION = sizeof...(Transitions);
+
+        template < typename State, typename Event >
+        static constexpr size_t transition_of() noexcept
+        {
+            constexpr std::array< bool, sizeof...(Transitions) + 1 > matches = {
+                (std::is_same_v< State, typename Transitions::StateT > &&
+                 std::is_same_v< Event, typename Transitions::EventT >)...,
+                true
+            };
+            size_t found = 0;
+            while (!matches[found])
+            {
+                ++found;
+            }
+            return found;
+        }
+
+        static_assert(detail::TransitionsFrom< Variant< States... >, Transitions... >,
+         "Transition from a state which is not an alternative of the machine");
+        static_assert(detail::DistinctTransitions< Transitions... >,
+         "Two transitions leave the same state on the same event");
+
+       public:
+        using StateVariant = Variant< States... >;
+
+        /// Starts in the first state, value-initialized
+        constexpr explicit StateMachine(Transitions... transitions):
+          transitions_(std::move(transitions)...)
+        {}
+
+        constexpr StateMachine(StateVariant initial, Transitions... transitions):
+          state_(std::move(initial)),
+          transitions_(std::move(transitions)...)
+        {}
+
+        /// Returns false if the current state has no transition on Event
+        template < typename Event >
+        bool dispatch(const Event & event)
+        {
+            return visit(
+             [&](auto & state)
+             {
+                 return handle(state, event);
+             },
+             state_);
+        }
+
+        /// Both the state and the event pick the handler, through a single table
+        template < typename... Events >
+        bool dispatch(const Variant< Events... > & event)
+        {
+            return visit(
+             [this](auto & state, const auto & alternative)
+             {
+                 return handle(state, alternative);
+             },
+             state_,
+             event);
+        }
+
+        const StateVariant & state() const noexcept
+        {
+            return state_;
+        }
+
+        template < typename State >
+        bool is() const noexcept
+        {
+            return state_.template holds< State >();
+        }
+
+       private:
+        template < typename State, typename Event >
+        bool handle(State & state, const Event & event)
+        {
+            constexpr size_t I = transition_of< State, Event >();
+            if constexpr (I == NO_TRANSITION)
+            {
+                return false;
+            }
+            else
+            {
+                auto & f = transitions_.template at< I >().f;
+                using Next = decltype(f(state, event));
+                if constexpr (std::is_void_v< Next >)
+                {
+                    f(state, event);
+                }
+                else
+                {
+                    static_assert(detail::OneOf< Next, States... >,
+                     "Transition leads to a state which is not an alternative of the machine");
+                    state_.template emplace< Next >(f(state, event));
+                }
+                return true;
+            }
+        }
+
+        StateVariant state_;
+        Tuple< Transitions... > transitions_;
+    };
+
+    template < typename... States, detail::AnyTransition... Transitions >
+        requires detail::TransitionsFrom< Variant< States... >, Transitions... > &&
+                 detail::DistinctTransitions< Transitions... >
+    constexpr auto make_state_machine(Transitions... transitions)
+    {
+        return StateMachine< Variant< States... >, Transitions... >{ std::move(transitions)... };
+    }
+
+    /// Machine starting in initial rather than in its first state
+    template < typename... States, detail::AnyTransition... Transitions >
+        requires detail::TransitionsFrom< Variant< States... >, Transitions... > &&
+                 detail::DistinctTransitions< Transitions... >
+    constexpr auto make_state_machine(
+     std::type_identity_t< Variant< States... > > initial, Transitions... transitions)
+    {
+        return StateMachine< Variant< States... >, Transitions... >{ std::move(initial),
+            std::move(transitions)... };
+    }
+}
+
+#endif
@@ -0,0 +1,534 @@
+#ifndef STCT_STATIC_HASH_MAP_HPP
+#define STCT_STATIC_HASH_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace static_containers
+{
+    namespace detail
+    {
+        /// Control bytes probed at once
+        constexpr size_t HASH_GROUP = 16;
+
+        /// Control byte of a free slot. Taken slots hold the low 7 bits of their hash, so their
+        /// top bit is clear
+        constexpr std::uint8_t CTRL_EMPTY = 0x80;
+
+        /// Bit i is set for each of the HASH_GROUP bytes at ctrl + i equal to byte
+        inline std::uint32_t match_byte(const std::uint8_t * ctrl, std::uint8_t byte) noexcept
+        {
+#ifdef __SSE2__
+            __m128i group = _mm_loadu_si128(reinterpret_cast< const __m128i * >(ctrl));
+            __m128i pattern = _mm_set1_epi8(static_cast< char >(byte));
+            return static_cast< std::uint32_t >(
+             _mm_movemask_epi8(_mm_cmpeq_epi8(group, pattern)));
+#else
+            std::uint32_t mask = 0;
+            for (size_t i = 0; i < HASH_GROUP; ++i)
+            {
+                mask |= std::uint32_t(ctrl[i] == byte) << i;
+            }
+            return mask;
+#endif
+        }
+
+        /// Bit i is set for each free slot among the HASH_GROUP at ctrl
+        inline std::uint32_t match_empty(const std::uint8_t * ctrl) noexcept
+        {
+#ifdef __SSE2__
+            __m128i group = _mm_loadu_si128(reinterpret_cast< const __m128i * >(ctrl));
+            return static_cast< std::uint32_t >(_mm_movemask_epi8(group));
+#else
+            return match_byte(ctrl, CTRL_EMPTY);
+#endif
+        }
+
+        /// Spreads hashes which are poor in their low bits, such as the identity on integers
+        constexpr std::uint64_t mix_hash(std::uint64_t hash) noexcept
+        {
+            hash *= 0x9e3779b97f4a7c15ull;
+            return hash ^ (hash >> 32);
+        }
+
+        template < typename Hash, typename KeyEqual >
+        concept TransparentLookup = requires {
+            typename Hash::is_transparent;
+            typename KeyEqual::is_transparent;
+        };
+    }
+
+    /// Hash map of up to N entries stored inline, with no allocation. Slots are probed linearly,
+    /// a group of control bytes at a time, and erasure shifts the following entries back instead
+    /// of leaving tombstones, so a lookup ends at the first free slot. With transparent Hash and
+    /// KeyEqual, lookups take anything comparable with K
+    template < typename K,
+     typename V,
+     size_t N,
+     typename Hash = std::hash< K >,
+     typename KeyEqual = std::equal_to< K > >
+    class StaticHashMap
+    {
+        static_assert(N > 0, "StaticHashMap needs room for at least one entry");
+
+        /// Enough slots to stay at most 7/8 full, and never less than a group
+        static constexpr size_t SLOTS =
+         std::bit_ceil(std::max(detail::HASH_GROUP, (N * 8 + 6) / 7));
+        static constexpr size_t MASK = SLOTS - 1;
+
+        struct Entry
+        {
+            K key;
+            V value;
+        };
+
+        union Slot
+        {
+            Slot() noexcept
+            {}
+
+            ~Slot()
+            {}
+
+            Entry entry;
+        };
+
+        /// Whether lookups take keys of other types as they are, rather than converted to K
+        static constexpr bool TRANSPARENT = detail::TransparentLookup< Hash, KeyEqual >;
+
+        /// Moves copy Hash and KeyEqual, which rhs still needs for whatever it holds next
+        static constexpr bool NOTHROW_MOVE = std::is_nothrow_move_constructible_v< Entry > &&
+                                             std::is_nothrow_copy_constructible_v< Hash > &&
+                                             std::is_nothrow_copy_constructible_v< KeyEqual > &&
+                                             std::is_nothrow_copy_assignable_v< Hash > &&
+                                             std::is_nothrow_copy_assignable_v< KeyEqual >;
+
+       public:
+        using KeyType = K;
+        using MappedType = V;
+        using SizeType = size_t;
+
+        StaticHashMap() noexcept
+        {
+            ctrl_.fill(detail::CTRL_EMPTY);
+        }
+
+        explicit StaticHashMap(Hash hash, KeyEqual equal = KeyEqual()):
+          hash_(std::move(hash)),
+          equal_(std::move(equal))
+        {
+            ctrl_.fill(detail::CTRL_EMPTY);
+        }
+
+        /// Entries keep their slots, so Hash and KeyEqual are copied along with them
+        StaticHashMap(const StaticHashMap & rhs):
+          hash_(rhs.hash_),
+          equal_(rhs.equal_)
+        {
+            ctrl_.fill(detail::CTRL_EMPTY);
+            copy_from(rhs);
+        }
+
+        StaticHashMap(StaticHashMap && rhs) noexcept(NOTHROW_MOVE):
+          hash_(rhs.hash_),
+          equal_(rhs.equal_)
+        {
+            ctrl_.fill(detail::CTRL_EMPTY);
+            copy_from(std::move(rhs));
+            rhs.clear();
+        }
+
+        StaticHashMap & operator=(const StaticHashMap & rhs)
+        {
+            if (this != std::addressof(rhs))
+            {
+                clear();
+                hash_ = rhs.hash_;
+                equal_ = rhs.equal_;
+                copy_from(rhs);
+            }
+            return *this;
+        }
+
+        StaticHashMap & operator=(StaticHashMap && rhs) noexcept(NOTHROW_MOVE)
+        {
+            if (this != std::addressof(rhs))
+            {
+                clear();
+                hash_ = rhs.hash_;
+                equal_ = rhs.equal_;
+                copy_from(std::move(rhs));
+                rhs.clear();
+            }
+            return *this;
+        }
+
+        ~StaticHashMap()
+        {
+            clear();
+        }
+
+        /// Value of key, constructed from args if key was missing. Throws std::length_error if it
+        /// was missing and the map is full
+        template < typename... Args >
+        std::pair< V *, bool > try_emplace(const K & key, Args &&... args)
+        {
+            return emplace_key(key, std::forward< Args >(args)...);
+        }
+
+        template < typename... Args >
+        std::pair< V *, bool > try_emplace(K && key, Args &&... args)
+        {
+            return emplace_key(std::move(key), std::forward< Args >(args)...);
+        }
+
+        template < typename U >
+        std::pair< V *, bool > insert_or_assign(K key, U && value)
+        {
+            auto result = try_emplace(std::move(key), std::forward< U >(value));
+            if (!result.second)
+            {
+                *result.first = std::forward< U >(value);
+            }
+            return result;
+        }
+
+        V & operator[](K key)
+        {
+            return *try_emplace(std::move(key)).first;
+        }
+
+        /// Value of key, nullptr if there is none. Lookups take anything convertible to K, and
+        /// with transparent Hash and KeyEqual anything comparable with K, as it is
+        V * find(const K & key) noexcept
+        {
+            return find_key(key);
+        }
+
+        const V * find(const K & key) const noexcept
+        {
+            return const_cast< StaticHashMap & >(*this).find_key(key);
+        }
+
+        template < typename Q >
+            requires TRANSPARENT
+        V * find(const Q & key) noexcept
+        {
+            return find_key(key);
+        }
+
+        template < typename Q >
+            requires TRANSPARENT
+        const V * find(const Q & key) const noexcept
+        {
+            return const_cast< StaticHashMap & >(*this).find_key(key);
+        }
+
+        bool contains(const K & key) const noexcept
+        {
+            return find(key) != nullptr;
+        }
+
+        template < typename Q >
+            requires TRANSPARENT
+        bool contains(const Q & key) const noexcept
+        {
+            return find(key) != nullptr;
+        }
+
+        /// Throws std::out_of_range if key is missing
+        V & at(const K & key)
+        {
+            return at_key(key);
+        }
+
+        const V & at(const K & key) const
+        {
+            return const_cast< StaticHashMap & >(*this).at_key(key);
+        }
+
+        template < typename Q >
+            requires TRANSPARENT
+        V & at(const Q & key)
+        {
+            return at_key(key);
+        }
+
+        template < typename Q >
+            requires TRANSPARENT
+        const V & at(const Q & key) const
+        {
+            return const_cast< StaticHashMap & >(*this).at_key(key);
+        }
+
+        bool erase(const K & key)
+        {
+            return erase_key(key);
+        }
+
+        template < typename Q >
+            requires TRANSPARENT
+        bool erase(const Q & key)
+        {
+            return erase_key(key);
+        }
+
+        void clear() noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v< Entry >)
+            {
+                for_each_slot(
+                 [&](size_t slot)
+                 {
+                     std::destroy_at(std::addressof(entry(slot)));
+                 });
+            }
+            ctrl_.fill(detail::CTRL_EMPTY);
+            size_ = 0;
+        }
+
+        /// Calls f(key, value) for every entry, in no particular order
+        template < typename F >
+        void for_each(F && f)
+        {
+            for_each_slot(
+             [&](size_t slot)
+             {
+                 f(std::as_const(entry(slot).key), entry(slot).value);
+             });
+        }
+
+        template < typename F >
+        void for_each(F && f) const
+        {
+            for_each_slot(
+             [&](size_t slot)
+             {
+                 f(entry(slot).key, std::as_const(entry(slot).value));
+             });
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        SizeType size() const noexcept
+        {
+            return size_;
+        }
+
+        static constexpr SizeType capacity() noexcept
+        {
+            return N;
+        }
+
+        /// Slots behind the capacity, which keep the load factor at most 7/8
+        static constexpr SizeType slot_count() noexcept
+        {
+            return SLOTS;
+        }
+
+       private:
+        template < typename Q >
+        V * find_key(const Q & key) noexcept
+        {
+            auto [slot, found] = probe(key, hash_of(key));
+            return found ? std::addressof(entry(slot).value) : nullptr;
+        }
+
+        template < typename Q >
+        V & at_key(const Q & key)
+        {
+            if (V * value = find_key(key))
+            {
+                return *value;
+            }
+            throw std::out_of_range("StaticHashMap has no such key");
+        }
+
+        /// Shifts back the entries probed past the erased one, so that no tombstone is left
+        template < typename Q >
+        bool erase_key(const Q & key)
+        {
+            auto [hole, found] = probe(key, hash_of(key));
+            if (!found)
+            {
+                return false;
+            }
+            std::destroy_at(std::addressof(entry(hole)));
+            for (size_t next = (hole + 1) & MASK; ctrl_[next] != detail::CTRL_EMPTY;
+                 next = (next + 1) & MASK)
+            {
+                size_t home = hash_of(entry(next).key) >> 7 & MASK;
+                // an entry may only move back while the hole lies within its probe sequence
+                if (((next - home) & MASK) >= ((next - hole) & MASK))
+                {
+                    relocate(next, hole);
+                    hole = next;
+                }
+            }
+            set_ctrl(hole, detail::CTRL_EMPTY);
+            --size_;
+            return true;
+        }
+
+        template < typename Q >
+        std::uint64_t hash_of(const Q & key) const noexcept
+        {
+            return detail::mix_hash(static_cast< std::uint64_t >(hash_(key)));
+        }
+
+        /// Where a lookup ended: the slot holding the key, or else the free slot closing its probe
+        /// sequence, which is where the key goes if inserted
+        struct Probe
+        {
+            size_t slot;
+            bool found;
+        };
+
+        /// The key, if present, sits between its home slot and the first free slot after it
+        template < typename Q >
+        Probe probe(const Q & key, std::uint64_t hash) const noexcept
+        {
+            auto h2 = static_cast< std::uint8_t >(hash & 0x7f);
+            for (size_t group = hash >> 7 & MASK;; group = (group + detail::HASH_GROUP) & MASK)
+            {
+                std::uint32_t matches = detail::match_byte(ctrl_.data() + group, h2);
+                std::uint32_t empties = detail::match_empty(ctrl_.data() + group);
+                if (empties != 0)
+                {
+                    // only slots before the first free one belong to the probe sequence
+                    matches &= (empties & -empties) - 1;
+                }
+                for (; matches != 0; matches &= matches - 1)
+                {
+                    size_t slot = (group + std::countr_zero(matches)) & MASK;
+                    if (equal_(entry(slot).key, key))
+                    {
+                        return { slot, true };
+                    }
+                }
+                if (empties != 0)
+                {
+                    return { (group + std::countr_zero(empties)) & MASK, false };
+                }
+            }
+        }
+
+        template < typename KeyT, typename... Args >
+        std::pair< V *, bool > emplace_key(KeyT && key, Args &&... args)
+        {
+            std::uint64_t hash = hash_of(key);
+            auto [slot, found] = probe(key, hash);
+            if (found)
+            {
+                return { std::addressof(entry(slot).value), false };
+            }
+            if (size_ == N)
+            {
+                throw std::length_error("StaticHashMap capacity exceeded");
+            }
+            ::new (static_cast< void * >(std::addressof(slots_[slot].entry)))
+             Entry{ K(std::forward< KeyT >(key)), V(std::forward< Args >(args)...) };
+            set_ctrl(slot, static_cast< std::uint8_t >(hash & 0x7f));
+            ++size_;
+            return { std::addressof(entry(slot).value), true };
+        }
+
+        /// Moves the entry of from into the free slot to, leaving from free
+        void relocate(size_t from, size_t to) noexcept
+        {
+            ::new (static_cast< void * >(std::addressof(slots_[to].entry)))
+             Entry(std::move(entry(from)));
+            std::destroy_at(std::addressof(entry(from)));
+            set_ctrl(to, ctrl_[from]);
+        }
+
+        /// The first HASH_GROUP - 1 control bytes are mirrored past the end, so that a group
+        /// read near the end wraps around
+        void set_ctrl(size_t slot, std::uint8_t byte) noexcept
+        {
+            ctrl_[slot] = byte;
+            if (slot < detail::HASH_GROUP - 1)
+            {
+                ctrl_[SLOTS + slot] = byte;
+            }
+        }
+
+        /// Copies or moves every entry of rhs into the same slot here, this being empty. Each
+        /// entry is counted as soon as it is built, so that if a later one throws, those are
+        /// destroyed and this is left empty
+        template < typename Other >
+        void copy_from(Other && rhs)
+        {
+            try
+            {
+                rhs.for_each_slot(
+                 [&](size_t slot)
+                 {
+                     auto * target = static_cast< void * >(std::addressof(slots_[slot].entry));
+                     if constexpr (std::is_rvalue_reference_v< Other && >)
+                     {
+                         ::new (target) Entry(std::move(rhs.entry(slot)));
+                     }
+                     else
+                     {
+                         ::new (target) Entry(rhs.entry(slot));
+                     }
+                     set_ctrl(slot, rhs.ctrl_[slot]);
+                     ++size_;
+                 });
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        template < typename F >
+        void for_each_slot(F && f) const
+        {
+            for (size_t slot = 0; slot < SLOTS; ++slot)
+            {
+                if (ctrl_[slot] != detail::CTRL_EMPTY)
+                {
+                    f(slot);
+                }
+            }
+        }
+
+        Entry & entry(size_t slot) noexcept
+        {
+            return *std::launder(std::addressof(slots_[slot].entry));
+        }
+
+        const Entry & entry(size_t slot) const noexcept
+        {
+            return *std::launder(std::addressof(slots_[slot].entry));
+        }
+
+        std::array< std::uint8_t, SLOTS + detail::HASH_GROUP - 1 > ctrl_;
+        size_t size_ = 0;
+        [[no_unique_address]] Hash hash_;
+        [[no_unique_address]] KeyEqual equal_;
+        Slot slots_[SLOTS];
+    };
+}
+
+#endif
@@ -0,0 +1,302 @@
+#ifndef STCT_STATIC_POOL_HPP
+#define STCT_STATIC_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace static_containers
+{
+    /// Fixed storage for up to N objects of T, handing out and taking back single slots in O(1)
+    /// with no allocation. A returned slot keeps the link to the next free one in its own
+    /// storage; slots never handed out yet are taken in order, so constructing a pool touches
+    /// none of them. Not thread safe: see AtomicStaticPool. Objects still alive when the pool is
+    /// destroyed are not destroyed
+    template < typename T, size_t N >
+    class StaticPool
+    {
+        struct FreeSlot
+        {
+            FreeSlot * next;
+        };
+
+        using Slot = std::aligned_storage_t< std::max(sizeof(T), sizeof(FreeSlot)),
+         std::max(alignof(T), alignof(FreeSlot)) >;
+
+       public:
+        using ValueType = T;
+
+        StaticPool() noexcept = default;
+
+        StaticPool(const StaticPool &) = delete;
+        StaticPool & operator=(const StaticPool &) = delete;
+
+        /// Raw storage for one T, nullptr once all N are taken
+        void * try_allocate() noexcept
+        {
+            if (free_ != nullptr)
+            {
+                ++in_use_;
+                return std::exchange(free_, free_->next);
+            }
+            if (fresh_ < N)
+            {
+                ++in_use_;
+                return std::addressof(storage_[fresh_++]);
+            }
+            return nullptr;
+        }
+
+        /// Throws std::bad_alloc once all N are taken
+        void * allocate()
+        {
+            if (void * slot = try_allocate())
+            {
+                return slot;
+            }
+            throw std::bad_alloc{};
+        }
+
+        /// Takes back storage from allocate, whose object is already destroyed
+        void deallocate(void * slot) noexcept
+        {
+            free_ = ::new (slot) FreeSlot{ free_ };
+            --in_use_;
+        }
+
+        /// Throws std::bad_alloc once all N objects are taken
+        template < typename... Args >
+        T * create(Args &&... args)
+        {
+            void * slot = allocate();
+            try
+            {
+                return ::new (slot) T(std::forward< Args >(args)...);
+            }
+            catch (...)
+            {
+                deallocate(slot);
+                throw;
+            }
+        }
+
+        void destroy(T * ptr) noexcept
+        {
+            std::destroy_at(ptr);
+            deallocate(ptr);
+        }
+
+        /// Whether ptr points into the storage of this pool
+        bool owns(const void * ptr) const noexcept
+        {
+            auto less = std::less< const void * >{};
+            return !less(ptr, storage_) && less(ptr, storage_ + N);
+        }
+
+        size_t in_use() const noexcept
+        {
+            return in_use_;
+        }
+
+        static constexpr size_t capacity() noexcept
+        {
+            return N;
+        }
+
+       private:
+        FreeSlot * free_ = nullptr;
+        size_t fresh_ = 0;
+        size_t in_use_ = 0;
+        Slot storage_[N];
+    };
+
+    /// StaticPool any number of threads may allocate from and deallocate to at once, without a
+    /// lock. Free slots form a Treiber stack of indices; the head carries a tag bumped on every
+    /// change, so that a slot popped and pushed back in between cannot fool a compare-exchange.
+    /// Links live in their own array rather than in the slots: a thread reading the link of a
+    /// slot another thread just took would otherwise race with the construction of its object
+    template < typename T, size_t N >
+    class AtomicStaticPool
+    {
+        static_assert(N < UINT32_MAX, "AtomicStaticPool indexes its slots with 32 bits");
+
+        using Index = std::uint32_t;
+        using Slot = std::aligned_storage_t< sizeof(T), alignof(T) >;
+
+        /// Index of no slot, ending the free list
+        static constexpr Index NIL = UINT32_MAX;
+
+        /// Index of the top slot in the low half, tag in the high half
+        using Head = std::uint64_t;
+
+       public:
+        using ValueType = T;
+
+        AtomicStaticPool() noexcept = default;
+
+        AtomicStaticPool(const AtomicStaticPool &) = delete;
+        AtomicStaticPool & operator=(const AtomicStaticPool &) = delete;
+
+        /// Raw storage for one T, nullptr once all N are taken
+        void * try_allocate() noexcept
+        {
+            Head head = head_.load(std::memory_order_acquire);
+            while (index(head) != NIL)
+            {
+                Head next = pack(next_[index(head)].load(std::memory_order_relaxed), head);
+                if (head_.compare_exchange_weak(
+                     head, next, std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    return std::addressof(storage_[index(head)]);
+                }
+            }
+            size_t fresh = fresh_.load(std::memory_order_relaxed);
+            while (fresh < N)
+            {
+                if (fresh_.compare_exchange_weak(fresh, fresh + 1, std::memory_order_relaxed))
+                {
+                    return std::addressof(storage_[fresh]);
+                }
+            }
+            return nullptr;
+        }
+
+        /// Throws std::bad_alloc once all N are taken
+        void * allocate()
+        {
+            if (void * slot = try_allocate())
+            {
+                return slot;
+            }
+            throw std::bad_alloc{};
+        }
+
+        /// Takes back storage from allocate, whose object is already destroyed
+        void deallocate(void * slot) noexcept
+        {
+            auto pushed = static_cast< Index >(static_cast< Slot * >(slot) - storage_);
+            Head head = head_.load(std::memory_order_relaxed);
+            do
+            {
+                next_[pushed].store(index(head), std::memory_order_relaxed);
+            } while (!head_.compare_exchange_weak(
+             head, pack(pushed, head), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /// Throws std::bad_alloc once all N objects are taken
+        template < typename... Args >
+        T * create(Args &&... args)
+        {
+            void * slot = allocate();
+            try
+            {
+                return ::new (slot) T(std::forward< Args >(args)...);
+            }
+            catch (...)
+            {
+                deallocate(slot);
+                throw;
+            }
+        }
+
+        void destroy(T * ptr) noexcept
+        {
+            std::destroy_at(ptr);
+            deallocate(ptr);
+        }
+
+        /// Whether ptr points into the storage of this pool
+        bool owns(const void * ptr) const noexcept
+        {
+            auto less = std::less< const void * >{};
+            return !less(ptr, storage_) && less(ptr, storage_ + N);
+        }
+
+        static constexpr size_t capacity() noexcept
+        {
+            return N;
+        }
+
+       private:
+        static Index index(Head head) noexcept
+        {
+            return static_cast< Index >(head);
+        }
+
+        /// New head on top of idx, tagged one past the tag of the head it replaces
+        static Head pack(Index idx, Head replaced) noexcept
+        {
+            return (((replaced >> 32) + 1) << 32) | idx;
+        }
+
+        std::atomic< Head > head_ = NIL;
+        std::atomic< size_t > fresh_ = 0;
+        std::atomic< Index > next_[N];
+        Slot storage_[N];
+    };
+
+    /// Allocator drawing single objects from a pool of N shared by every allocator of the same
+    /// type, so that node-based std containers keep their nodes in static storage. Requests for
+    /// arrays, such as the bucket arrays of unordered containers, go to std::allocator. With the
+    /// default StaticPool, every container using this allocator type, in the whole program, must
+    /// stay on one and the same thread: two containers on two threads race on the one free list.
+    /// AtomicStaticPool lifts that restriction
+    template < typename T, size_t N, template < typename, size_t > typename Pool = StaticPool >
+    class StaticPoolAllocator
+    {
+       public:
+        using value_type = T;
+
+        template < typename U >
+        struct rebind
+        {
+            using other = StaticPoolAllocator< U, N, Pool >;
+        };
+
+        StaticPoolAllocator() noexcept = default;
+
+        template < typename U >
+        StaticPoolAllocator(const StaticPoolAllocator< U, N, Pool > &) noexcept
+        {}
+
+        /// Throws std::bad_alloc once the pool is exhausted
+        T * allocate(size_t n)
+        {
+            if (n == 1)
+            {
+                return static_cast< T * >(pool().allocate());
+            }
+            return std::allocator< T >{}.allocate(n);
+        }
+
+        void deallocate(T * ptr, size_t n) noexcept
+        {
+            if (n == 1)
+            {
+                pool().deallocate(ptr);
+                return;
+            }
+            std::allocator< T >{}.deallocate(ptr, n);
+        }
+
+        /// One for the whole program, whichever thread asks
+        static Pool< T, N > & pool() noexcept
+        {
+            static Pool< T, N > instance;
+            return instance;
+        }
+
+        friend bool operator==(const StaticPoolAllocator &, const StaticPoolAllocator &) noexcept
+        {
+            return true;
+        }
+    };
+}
+
+#endif
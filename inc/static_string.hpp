@@ -0,0 +1,364 @@
+#ifndef STCT_STATIC_STRING_HPP
+#define STCT_STATIC_STRING_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace static_containers
+{
+    namespace detail
+    {
+        /// Narrowest unsigned type counting up to N
+        template < size_t N >
+        using SizeFor = std::conditional_t< N <= UINT8_MAX,
+         std::uint8_t,
+         std::conditional_t< N <= UINT16_MAX,
+          std::uint16_t,
+          std::conditional_t< N <= UINT32_MAX, std::uint32_t, size_t > > >;
+
+        /// Characters of chars before its first null, all M - 1 but the last if it has none: a
+        /// literal, or an array holding a shorter string
+        template < typename CharT, size_t M >
+        constexpr size_t array_length(const CharT (&chars)[M]) noexcept
+        {
+            size_t length = 0;
+            while (length < M - 1 && chars[length] != CharT())
+            {
+                ++length;
+            }
+            return length;
+        }
+
+        /// Bytes compared at once by string equality
+        constexpr size_t STRING_CHUNK = 16;
+
+        /// Equality of size bytes of two buffers which stay readable up to the next whole chunk,
+        /// and hold the same bytes past size
+        inline bool equal_chunks(const void * lhs, const void * rhs, size_t size) noexcept
+        {
+#ifdef __SSE2__
+            auto l = static_cast< const char * >(lhs);
+            auto r = static_cast< const char * >(rhs);
+            for (size_t i = 0; i < size; i += STRING_CHUNK)
+            {
+                __m128i lchunk = _mm_loadu_si128(reinterpret_cast< const __m128i * >(l + i));
+                __m128i rchunk = _mm_loadu_si128(reinterpret_cast< const __m128i * >(r + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(lchunk, rchunk)) != 0xffff)
+                {
+                    return false;
+                }
+            }
+            return true;
+#else
+            return std::memcmp(lhs, rhs, size) == 0;
+#endif
+        }
+    }
+
+    /// String of up to N characters stored inline, null-terminated, with no allocation and no
+    /// pointer inside: an array of them is one contiguous block. Characters past the size are
+    /// always zero, which lets equality compare whole chunks at a time
+    template < typename CharT, size_t N >
+    class BasicStaticString
+    {
+        static_assert(sizeof(CharT) == 1, "BasicStaticString holds narrow characters");
+
+        /// Room for N characters and the terminator, rounded up to whole chunks
+        static constexpr size_t STORAGE =
+         (N + 1 + detail::STRING_CHUNK - 1) / detail::STRING_CHUNK * detail::STRING_CHUNK;
+
+       public:
+        using ValueType = CharT;
+        using SizeType = size_t;
+        using Reference = CharT &;
+        using ConstReference = const CharT &;
+        using Pointer = CharT *;
+        using ConstPointer = const CharT *;
+        using Iterator = CharT *;
+        using ConstIterator = const CharT *;
+        using ViewType = std::basic_string_view< CharT >;
+        using Traits = std::char_traits< CharT >;
+
+        constexpr BasicStaticString() noexcept = default;
+
+        /// Characters of a literal, or of an array up to its first null. Too big an array is a
+        /// compile error, however short the string in it
+        template < size_t M >
+        constexpr BasicStaticString(const CharT (&literal)[M]) noexcept
+        {
+            static_assert(M >= 1 && M - 1 <= N, "Literal does not fit into the string");
+            assign(ViewType(literal, detail::array_length(literal)));
+        }
+
+        /// Throws std::length_error if view is longer than N
+        constexpr explicit BasicStaticString(ViewType view)
+        {
+            assign(view);
+        }
+
+        constexpr BasicStaticString & assign(ViewType view)
+        {
+            if (view.size() > N)
+            {
+                throw std::length_error("StaticString capacity exceeded");
+            }
+            // view may point into this string, so it is moved down before the tail is zeroed
+            if (std::is_constant_evaluated())
+            {
+                // Traits::move compares unrelated pointers, which constant evaluation rejects. A
+                // view of this string starts at chars_ or after, so copying forward is safe
+                std::copy(view.begin(), view.end(), chars_);
+            }
+            else
+            {
+                Traits::move(chars_, view.data(), view.size());
+            }
+            if (view.size() < size_)
+            {
+                std::fill(chars_ + view.size(), chars_ + size_, CharT());
+            }
+            size_ = static_cast< detail::SizeFor< N > >(view.size());
+            return *this;
+        }
+
+        constexpr BasicStaticString & append(ViewType view)
+        {
+            if (view.size() > N - size())
+            {
+                throw std::length_error("StaticString capacity exceeded");
+            }
+            Traits::copy(chars_ + size_, view.data(), view.size());
+            size_ = static_cast< detail::SizeFor< N > >(size_ + view.size());
+            return *this;
+        }
+
+        constexpr BasicStaticString & operator+=(ViewType view)
+        {
+            return append(view);
+        }
+
+        constexpr BasicStaticString & operator+=(CharT ch)
+        {
+            push_back(ch);
+            return *this;
+        }
+
+        constexpr void push_back(CharT ch)
+        {
+            if (size_ == N)
+            {
+                throw std::length_error("StaticString capacity exceeded");
+            }
+            chars_[size_++] = ch;
+        }
+
+        constexpr void pop_back() noexcept
+        {
+            assert(!empty());
+            chars_[--size_] = CharT();
+        }
+
+        constexpr void clear() noexcept
+        {
+            std::fill_n(chars_, size_, CharT());
+            size_ = 0;
+        }
+
+        constexpr void resize(SizeType count, CharT ch = CharT())
+        {
+            if (count > N)
+            {
+                throw std::length_error("StaticString capacity exceeded");
+            }
+            if (count < size_)
+            {
+                std::fill(chars_ + count, chars_ + size_, CharT());
+            }
+            else
+            {
+                std::fill(chars_ + size_, chars_ + count, ch);
+            }
+            size_ = static_cast< detail::SizeFor< N > >(count);
+        }
+
+        constexpr Reference operator[](SizeType pos) noexcept
+        {
+            assert(pos < size_);
+            return chars_[pos];
+        }
+
+        constexpr ConstReference operator[](SizeType pos) const noexcept
+        {
+            assert(pos < size_);
+            return chars_[pos];
+        }
+
+        constexpr Reference front() noexcept
+        {
+            return (*this)[0];
+        }
+
+        constexpr ConstReference front() const noexcept
+        {
+            return (*this)[0];
+        }
+
+        constexpr Reference back() noexcept
+        {
+            return (*this)[size_ - 1];
+        }
+
+        constexpr ConstReference back() const noexcept
+        {
+            return (*this)[size_ - 1];
+        }
+
+        constexpr Pointer data() noexcept
+        {
+            return chars_;
+        }
+
+        constexpr ConstPointer data() const noexcept
+        {
+            return chars_;
+        }
+
+        constexpr ConstPointer c_str() const noexcept
+        {
+            return chars_;
+        }
+
+        constexpr Iterator begin() noexcept
+        {
+            return chars_;
+        }
+
+        constexpr ConstIterator begin() const noexcept
+        {
+            return chars_;
+        }
+
+        constexpr Iterator end() noexcept
+        {
+            return chars_ + size_;
+        }
+
+        constexpr ConstIterator end() const noexcept
+        {
+            return chars_ + size_;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        constexpr SizeType size() const noexcept
+        {
+            return size_;
+        }
+
+        constexpr SizeType length() const noexcept
+        {
+            return size_;
+        }
+
+        static constexpr SizeType capacity() noexcept
+        {
+            return N;
+        }
+
+        constexpr ViewType view() const noexcept
+        {
+            return { chars_, size_ };
+        }
+
+        constexpr operator ViewType() const noexcept
+        {
+            return view();
+        }
+
+        /// Sizes first, then the characters a chunk at a time
+        friend constexpr bool operator==(
+         const BasicStaticString & lhs, const BasicStaticString & rhs) noexcept
+        {
+            if (lhs.size_ != rhs.size_)
+            {
+                return false;
+            }
+            if (std::is_constant_evaluated())
+            {
+                return lhs.view() == rhs.view();
+            }
+            return detail::equal_chunks(lhs.chars_, rhs.chars_, lhs.size_);
+        }
+
+        friend constexpr bool operator==(const BasicStaticString & lhs, ViewType rhs) noexcept
+        {
+            return lhs.view() == rhs;
+        }
+
+        template < size_t M >
+        friend constexpr bool operator==(
+         const BasicStaticString & lhs, const CharT (&rhs)[M]) noexcept
+        {
+            return lhs.view() == ViewType(rhs, detail::array_length(rhs));
+        }
+
+        friend constexpr std::strong_ordering operator<=>(
+         const BasicStaticString & lhs, const BasicStaticString & rhs) noexcept
+        {
+            return lhs.view() <=> rhs.view();
+        }
+
+        friend constexpr std::strong_ordering operator<=>(
+         const BasicStaticString & lhs, ViewType rhs) noexcept
+        {
+            return lhs.view() <=> rhs;
+        }
+
+        template < size_t M >
+        friend constexpr std::strong_ordering operator<=>(
+         const BasicStaticString & lhs, const CharT (&rhs)[M]) noexcept
+        {
+            return lhs.view() <=> ViewType(rhs, detail::array_length(rhs));
+        }
+
+       private:
+        CharT chars_[STORAGE] = {};
+        detail::SizeFor< N > size_ = 0;
+    };
+
+    template < size_t N >
+    using StaticString = BasicStaticString< char, N >;
+
+    template < size_t N >
+    using StaticU8String = BasicStaticString< char8_t, N >;
+
+    /// StaticString just big enough for a literal, or for any string an array can hold
+    template < typename CharT, size_t M >
+    BasicStaticString(const CharT (&)[M]) -> BasicStaticString< CharT, M - 1 >;
+}
+
+template < typename CharT, size_t N >
+struct std::hash< static_containers::BasicStaticString< CharT, N > >
+{
+    size_t operator()(const static_containers::BasicStaticString< CharT, N > & str) const noexcept
+    {
+        return std::hash< std::basic_string_view< CharT > >{}(str.view());
+    }
+};
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef STCT_TASK_GRAPH_HPP
+#define STCT_TASK_GRAPH_HPP
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "parallel.hpp"
+#include "thread_pool.hpp"
+#include "traits.hpp"
+#include "tuple.hpp"
+
+namespace static_containers
+{
+    /// Callable f of a TaskGraph, called with the results of stages DEPS, in that order
+    template < typename F, size_t... DEPS >
+    struct Stage
+    {
+        using Fn = F;
+        using Deps = std::index_sequence< DEPS... >;
+
+        F f;
+    };
+
+    template < size_t... DEPS, typename F >
+    constexpr Stage< F, DEPS... > stage(F f)
+    {
+        return { std::move(f) };
+    }
+
+    /// Result slot of a stage returning nothing
+    struct StageDone
+    {
+        auto operator<=>(const StageDone &) const noexcept = default;
+    };
+
+    namespace detail
+    {
+        template < size_t N >
+        struct Schedule
+        {
+            /// Stages level by level, those of one level depend only on earlier levels
+            std::array< size_t, N > order{};
+            /// Level L is order[level_begin[L], level_begin[L + 1])
+            std::array< size_t, N + 1 > level_begin{};
+            size_t levels = 0;
+            bool acyclic = false;
+        };
+
+        template < size_t... DEPS >
+        constexpr std::array< size_t, sizeof...(DEPS) > deps_of(std::index_sequence< DEPS... >)
+        {
+            return { DEPS... };
+        }
+
+        template < size_t N, size_t... DEPS >
+        constexpr bool deps_below(std::index_sequence< DEPS... >)
+        {
+            return ((DEPS < N) && ...);
+        }
+
+        /// Kahn's algorithm taking the whole frontier at once, so each round is one level
+        template < typename... Stages >
+        constexpr Schedule< sizeof...(Stages) > make_schedule()
+        {
+            constexpr size_t N = sizeof...(Stages);
+            Schedule< N > result;
+            std::array< size_t, N > pending = { deps_of(typename Stages::Deps{}).size()... };
+            std::array< bool, N > done{};
+            size_t scheduled = 0;
+            while (scheduled < N)
+            {
+                size_t level_end = scheduled;
+                for (size_t i = 0; i < N; ++i)
+                {
+                    if (!done[i] && pending[i] == 0)
+                    {
+                        result.order[level_end++] = i;
+                    }
+                }
+                if (level_end == scheduled)
+                {
+                    return result;
+                }
+                for (size_t k = scheduled; k < level_end; ++k)
+                {
+                    done[result.order[k]] = true;
+                }
+                size_t stage = 0;
+                (
+                 [&]()
+                 {
+                     for (size_t dep: deps_of(typename Stages::Deps{}))
+                     {
+                         for (size_t k = scheduled; k < level_end; ++k)
+                         {
+                             pending[stage] -= dep == result.order[k];
+                         }
+                     }
+                     ++stage;
+                 }(),
+                 ...);
+                result.level_begin[++result.levels] = level_end;
+                scheduled = level_end;
+            }
+            result.acyclic = true;
+            return result;
+        }
+
+        template < typename StagesPack, size_t I >
+        struct StageResult;
+
+        template < typename... Stages, size_t I >
+        struct StageResult< pack< Stages... >, I >
+        {
+            using StageT = ith< I, Stages... >::type;
+
+            template < size_t... DEPS >
+            static auto call(std::index_sequence< DEPS... >) -> std::invoke_result_t<
+             typename StageT::Fn &,
+             const typename StageResult< pack< Stages... >, DEPS >::type &... >;
+
+            using Returned = decltype(call(typename StageT::Deps{}));
+            using type = std::conditional_t< std::is_void_v< Returned >,
+             StageDone,
+             std::decay_t< Returned > >;
+        };
+    }
+
+    /// Stages with dependencies known at compile time. Stages are scheduled into levels by a
+    /// constexpr topological sort; run() executes level after level, stages of one level in
+    /// parallel on a ThreadPool. Every result lives in a Tuple slot on the stack of run() and
+    /// reaches dependent stages by const reference
+    template < typename... Stages >
+    class TaskGraph
+    {
+        static_assert((detail::deps_below< sizeof...(Stages) >(typename Stages::Deps{}) && ...),
+         "Stage depends on a stage which does not exist");
+
+        static constexpr auto SCHEDULE = detail::make_schedule< Stages... >();
+        static_assert(SCHEDULE.acyclic, "Stage dependencies form a cycle");
+
+        template < size_t I >
+        using StageResult = detail::StageResult< pack< Stages... >, I >;
+
+        template < size_t I >
+        using Result = StageResult< I >::type;
+
+       public:
+        constexpr TaskGraph(Stages... stages):
+          stages_(std::move(stages)...)
+        {}
+
+        static constexpr size_t size() noexcept
+        {
+            return sizeof...(Stages);
+        }
+
+        static constexpr size_t levels() noexcept
+        {
+            return SCHEDULE.levels;
+        }
+
+        /// Stages of level, in the order they are started
+        static constexpr std::span< const size_t > level(size_t level) noexcept
+        {
+            return std::span(SCHEDULE.order)
+             .subspan(SCHEDULE.level_begin[level],
+              SCHEDULE.level_begin[level + 1] - SCHEDULE.level_begin[level]);
+        }
+
+        /// Runs every stage once and returns all results, StageDone for stages returning nothing.
+        /// The first exception stops the run after the level it was thrown in
+        auto run(ThreadPool & pool = ThreadPool::instance())
+        {
+            return [&]< size_t... Is >(std::index_sequence< Is... >)
+            {
+                using Slots = Tuple< std::optional< Result< Is > >... >;
+
+                Slots slots{ std::optional< Result< Is > >{}... };
+                State< Slots > state{ *this, slots };
+                std::array< TaskGroup::Job, size() > jobs = {
+                    TaskGroup::Job{ &detail::run_element< Is, decltype(state) >, &state }...
+                };
+
+                TaskGroup group(pool);
+                for (size_t level = 0; level < SCHEDULE.levels; ++level)
+                {
+                    size_t first = SCHEDULE.level_begin[level];
+                    for (size_t k = first + 1; k < SCHEDULE.level_begin[level + 1]; ++k)
+                    {
+                        group.run(jobs[SCHEDULE.order[k]]);
+                    }
+                    group.run_inline(jobs[SCHEDULE.order[first]]);
+                    group.wait();
+                }
+                return Tuple< Result< Is >... >{ std::move(*get< Is >(slots))... };
+            }(std::index_sequence_for< Stages... >{});
+        }
+
+       private:
+        template < typename Slots >
+        struct State
+        {
+            template < size_t I >
+            void run()
+            {
+                auto & f = graph.stages_.template at< I >().f;
+                const auto & inputs = slots;
+                [&]< size_t... DEPS >(std::index_sequence< DEPS... >)
+                {
+                    if constexpr (std::is_void_v< typename StageResult< I >::Returned >)
+                    {
+                        f(*get< DEPS >(inputs)...);
+                        slots.template at< I >().emplace();
+                    }
+                    else
+                    {
+                        slots.template at< I >().emplace(f(*get< DEPS >(inputs)...));
+                    }
+                }(typename ith< I, Stages... >::type::Deps{});
+            }
+
+            TaskGraph & graph;
+            Slots & slots;
+        };
+
+        Tuple< Stages... > stages_;
+    };
+
+    template < typename... Stages >
+    constexpr auto make_task_graph(Stages... stages)
+    {
+        return TaskGraph< Stages... >{ std::move(stages)... };
+    }
+}
+
+#endif
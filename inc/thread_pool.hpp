@@ -0,0 +1,244 @@
+#ifndef STCT_THREAD_POOL_HPP
+#define STCT_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace static_containers
+{
+    /// Fixed set of worker threads fed from a fixed-capacity ring of tasks. A task is a function
+    /// pointer and its context, so submitting one never allocates
+    class ThreadPool
+    {
+       public:
+        static constexpr size_t MAX_WORKERS = 64;
+        static constexpr size_t QUEUE_CAPACITY = 256;
+
+        struct Task
+        {
+            void (*fn)(void *) noexcept;
+            void * ctx;
+        };
+
+        explicit ThreadPool(size_t workers = default_workers())
+        {
+            workers = std::clamp< size_t >(workers, 1, MAX_WORKERS);
+            for (size_t i = 0; i < workers; ++i)
+            {
+                threads_.emplace_back(
+                 [this]()
+                 {
+                     work();
+                 });
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool & operator=(const ThreadPool &) = delete;
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+            ready_.notify_all();
+            for (auto & thread: threads_)
+            {
+                thread.join();
+            }
+        }
+
+        /// Pool shared by the parallel algorithms, one worker less than there are hardware threads:
+        /// the thread waiting for results runs tasks too
+        static ThreadPool & instance()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        static size_t default_workers() noexcept
+        {
+            size_t hardware = std::thread::hardware_concurrency();
+            return hardware > 1 ? hardware - 1 : 1;
+        }
+
+        size_t workers() const noexcept
+        {
+            return threads_.size();
+        }
+
+        /// Returns false if the queue is full, the caller is expected to run the task itself then
+        bool try_submit(Task task)
+        {
+            {
+                std::lock_guard lock(mutex_);
+                if (size_ == QUEUE_CAPACITY)
+                {
+                    return false;
+                }
+                queue_[(head_ + size_) % QUEUE_CAPACITY] = task;
+                ++size_;
+            }
+            ready_.notify_one();
+            return true;
+        }
+
+        /// Runs one queued task on the calling thread. Returns false if there was none
+        bool run_one()
+        {
+            Task task;
+            {
+                std::lock_guard lock(mutex_);
+                if (size_ == 0)
+                {
+                    return false;
+                }
+                task = pop();
+            }
+            task.fn(task.ctx);
+            return true;
+        }
+
+       private:
+        Task pop() noexcept
+        {
+            Task task = queue_[head_];
+            head_ = (head_ + 1) % QUEUE_CAPACITY;
+            --size_;
+            return task;
+        }
+
+        void work()
+        {
+            while (true)
+            {
+                Task task;
+                {
+                    std::unique_lock lock(mutex_);
+                    ready_.wait(lock,
+                     [this]()
+                     {
+                         return stopping_ || size_ != 0;
+                     });
+                    if (size_ == 0)
+                    {
+                        return;
+                    }
+                    task = pop();
+                }
+                task.fn(task.ctx);
+            }
+        }
+
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::array< Task, QUEUE_CAPACITY > queue_;
+        size_t head_ = 0;
+        size_t size_ = 0;
+        bool stopping_ = false;
+        Vector< std::thread, MAX_WORKERS > threads_;
+    };
+
+    /// Fork-join scope over a ThreadPool. wait() returns once every job run through the group is
+    /// done, running queued tasks on the calling thread meanwhile, so groups may nest. The first
+    /// exception thrown by a job is rethrown from wait()
+    class TaskGroup
+    {
+       public:
+        /// Work and its context. Both stay owned by the caller and must outlive wait()
+        struct Job
+        {
+            void (*fn)(void *);
+            void * ctx;
+            TaskGroup * group = nullptr;
+        };
+
+        explicit TaskGroup(ThreadPool & pool = ThreadPool::instance()) noexcept:
+          pool_(pool)
+        {}
+
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup & operator=(const TaskGroup &) = delete;
+
+        ~TaskGroup()
+        {
+            drain();
+        }
+
+        void run(Job & job)
+        {
+            job.group = this;
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            if (!pool_.try_submit({ &TaskGroup::execute, &job }))
+            {
+                execute(&job);
+            }
+        }
+
+        /// Runs job right here, still reporting its exception through wait()
+        void run_inline(Job & job)
+        {
+            job.group = this;
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            execute(&job);
+        }
+
+        void wait()
+        {
+            drain();
+            if (error_)
+            {
+                std::rethrow_exception(std::exchange(error_, nullptr));
+            }
+        }
+
+       private:
+        static void execute(void * ptr) noexcept
+        {
+            auto & job = *static_cast< Job * >(ptr);
+            auto & group = *job.group;
+            try
+            {
+                job.fn(job.ctx);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(group.error_mutex_);
+                if (!group.error_)
+                {
+                    group.error_ = std::current_exception();
+                }
+            }
+            // the group may be gone right after this, nothing touches it any more
+            group.pending_.fetch_sub(1, std::memory_order_release);
+        }
+
+        void drain()
+        {
+            while (pending_.load(std::memory_order_acquire) != 0)
+            {
+                if (!pool_.run_one())
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        ThreadPool & pool_;
+        std::atomic< size_t > pending_ = 0;
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+    };
+}
+
+#endif
@@ -1,59 +1,182 @@
+#ifndef STCT_TRAITS_HPP
+#define STCT_TRAITS_HPP
+
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <utility>
+
+#include "comparators.hpp"
+
 namespace static_containers
 {
     namespace detail
     {
-        template < int DESIRED, int I, typename T, typename... Ts >
-        struct ith_impl
+        template < size_t I, typename T >
+        struct Indexed
         {
-            using type = typename ith_impl< DESIRED, I + 1, Ts... >::type;
+            using type = T;
         };
 
-        template < int DESIRED, typename T, typename... Ts >
-        struct ith_impl< DESIRED, DESIRED - 1, T, Ts... >
+        template < typename Indices, typename... Ts >
+        struct IndexedPack;
+
+        template < size_t... Is, typename... Ts >
+        struct IndexedPack< std::index_sequence< Is... >, Ts... >: Indexed< Is, Ts >...
+        {};
+
+        /// Picks the only base with a matching index through overload resolution, so lookup does
+        /// not recurse over the pack
+        template < size_t I, typename T >
+        Indexed< I, T > select(const Indexed< I, T > &);
+
+        template < size_t I, typename T >
+        struct ArgRef
         {
-            using type = T;
+            T && ref;
         };
+
+        template < typename Indices, typename... Args >
+        struct ArgRefs;
+
+        /// References to a whole argument list, each reachable without recursion over the others
+        template < size_t... Is, typename... Args >
+        struct ArgRefs< std::index_sequence< Is... >, Args... >: ArgRef< Is, Args >...
+        {};
+
+        template < size_t I, typename T >
+        constexpr T && arg_at(const ArgRef< I, T > & arg) noexcept
+        {
+            return std::forward< T >(arg.ref);
+        }
     }
 
-    template < int I, typename T, typename... Ts >
+    template < size_t I, typename... Ts >
     struct ith
     {
-        using type = detail::ith_impl< I, 0, Ts... >::type;
+        static_assert(I < sizeof...(Ts), "Requested pack index is out of bounds");
+        using type = typename decltype(detail::select< I >(
+         std::declval< detail::IndexedPack< std::index_sequence_for< Ts... >, Ts... > >()))::type;
     };
 
     namespace detail
     {
-        template < typename TypeComparator >
-        constexpr bool pack_sorted_impl() noexcept
+        /// Bottom-up merge sort of indices: no recursion, stable, usable in constant expressions
+        template < size_t N, typename Less >
+        constexpr void merge_sort(std::array< size_t, N > & arr, Less less) noexcept
         {
-            return true;
+            std::array< size_t, N > buf{};
+            for (size_t width = 1; width < N; width *= 2)
+            {
+                for (size_t lo = 0; lo < N; lo += 2 * width)
+                {
+                    size_t mid = std::min(lo + width, N);
+                    size_t hi = std::min(lo + 2 * width, N);
+                    size_t i = lo;
+                    size_t j = mid;
+                    size_t k = lo;
+                    while (i < mid && j < hi)
+                    {
+                        buf[k++] = less(arr[j], arr[i]) ? arr[j++] : arr[i++];
+                    }
+                    while (i < mid)
+                    {
+                        buf[k++] = arr[i++];
+                    }
+                    while (j < hi)
+                    {
+                        buf[k++] = arr[j++];
+                    }
+                }
+                arr = buf;
+            }
         }
 
-        template < typename TypeComparator, typename First >
-        constexpr bool pack_sorted_impl() noexcept
+        /// Answers of a comparator without key projection, each pair instantiated exactly once
+        template < typename TypeComparator, typename... Args >
+        struct PairwiseTable
+        {
+            template < typename T >
+            static constexpr std::array< bool, sizeof...(Args) > row = {
+                TypeComparator::template value< T, Args >()...
+            };
+
+            static constexpr std::array< std::array< bool, sizeof...(Args) >, sizeof...(Args) >
+             table = { row< Args >... };
+        };
+
+        /// Index in Args of the element at each position once stably sorted by TypeComparator.
+        /// Keyed comparators cost one key instantiation per type, others a pairwise table
+        template < typename TypeComparator, typename... Args >
+        constexpr std::array< size_t, sizeof...(Args) > sorted_order() noexcept
         {
-            return pack_sorted_impl< TypeComparator >();
+            std::array< size_t, sizeof...(Args) > order{};
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                order[i] = i;
+            }
+            if constexpr (KeyedTypeComparator< TypeComparator > && sizeof...(Args) > 0)
+            {
+                constexpr std::array keys = { TypeComparator::template key< Args >()... };
+                merge_sort(order,
+                 [&](size_t lhs, size_t rhs)
+                 {
+                     return TypeComparator::compare_keys(keys[lhs], keys[rhs]);
+                 });
+            }
+            else if constexpr (sizeof...(Args) > 0)
+            {
+                constexpr auto & table = PairwiseTable< TypeComparator, Args... >::table;
+                merge_sort(order,
+                 [&](size_t lhs, size_t rhs)
+                 {
+                     return table[lhs][rhs];
+                 });
+            }
+            return order;
         }
 
-        template < typename TypeComparator, typename First, typename Second, typename... Other >
+        template < typename TypeComparator, typename... Args >
+        constexpr std::array< size_t, sizeof...(Args) > sorted_order_v =
+         sorted_order< TypeComparator, Args... >();
+
+        template < typename TypeComparator, typename... Args >
         constexpr bool pack_sorted_impl() noexcept
         {
-            return !TypeComparator::template value< Second, First >() &&
-                   pack_sorted_impl< TypeComparator, Second, Other... >();
+            constexpr auto & order = sorted_order_v< TypeComparator, Args... >;
+            return [&]< size_t... Is >(std::index_sequence< Is... >)
+            {
+                return ((order[Is] == Is) && ...);
+            }(std::make_index_sequence< sizeof...(Args) >{});
         }
     }
 
+    template < typename... Args >
+    struct pack;
+
+    namespace detail
+    {
+        template < typename TypeComparator, typename... Args, size_t... Is >
+        auto sorted_pack(std::index_sequence< Is... >) -> pack<
+         typename ith< sorted_order_v< TypeComparator, Args... >[Is], Args... >::type... >;
+    }
+
     template < typename... Args >
     struct pack
     {
         template < size_t I >
         using type_at = ith< I, Args... >::type;
 
+        template < typename TypeComparator >
+        using sorted = decltype(detail::sorted_pack< TypeComparator, Args... >(
+         std::make_index_sequence< sizeof...(Args) >{}));
+
         template < typename TypeComparator >
         constexpr static bool is_sorted() noexcept
         {
             return detail::pack_sorted_impl< TypeComparator, Args... >();
         }
     };
-}
\ No newline at end of file
+}
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef STCT_TUPLE_HPP
 #define STCT_TUPLE_HPP
 
+#include <concepts>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include "traits.hpp"
@@ -10,75 +12,79 @@ namespace static_containers
 {
     namespace detail
     {
-        template < typename... Args >
-        struct TupleHead;
-
-        template < typename T, typename... Args >
-        struct TupleHead< T, Args... >
+        /// One element of a tuple. Index keeps leaves of equal types apart, so each of them is a
+        /// distinct base and empty elements take no space
+        template < size_t I, typename T >
+        struct TupleLeaf
         {
-            TupleHead(T v, Args... args):
-              v(std::forward< T >(v)),
-              next(std::forward< Args >(args)...)
+            constexpr explicit TupleLeaf(std::in_place_t):
+              v()
             {}
-            TupleHead(const TupleHead &) = default;
-            TupleHead(TupleHead &&) = default;
-            TupleHead & operator=(const TupleHead &) = default;
-            TupleHead & operator=(TupleHead &&) = default;
 
-            template < size_t I >
-            constexpr auto & at() noexcept
-            {
-                if constexpr (I == 0)
-                {
-                    return v;
-                }
-                else
-                {
-                    return next.template at< I - 1 >();
-                }
-            }
-
-            template < size_t I >
-            constexpr const auto & at() const noexcept
-            {
-                if constexpr (I == 0)
-                {
-                    return v;
-                }
-                else
-                {
-                    return next.template at< I - 1 >();
-                }
-            }
-
-            auto operator<=>(const TupleHead & rhs) const noexcept = default;
-
-            T v;
-            TupleHead< Args... > next;
+            template < typename U >
+            constexpr TupleLeaf(std::in_place_t, U && u):
+              v(std::forward< U >(u))
+            {}
+            TupleLeaf(const TupleLeaf &) = default;
+            TupleLeaf(TupleLeaf &&) = default;
+            TupleLeaf & operator=(const TupleLeaf &) = default;
+            TupleLeaf & operator=(TupleLeaf &&) = default;
+
+            auto operator<=>(const TupleLeaf & rhs) const noexcept = default;
+
+            [[no_unique_address]] T v;
         };
 
-        template <>
-        struct TupleHead<>
-        {
-            TupleHead() = default;
+        template < typename Indices, typename... Args >
+        struct TupleStorage;
 
-            TupleHead(const TupleHead &) = default;
-            TupleHead(TupleHead &&) = default;
-            TupleHead & operator=(const TupleHead &) = default;
-            TupleHead & operator=(TupleHead &&) = default;
+        template < size_t... Is, typename... Args >
+        struct TupleStorage< std::index_sequence< Is... >, Args... >: TupleLeaf< Is, Args >...
+        {
+            constexpr explicit TupleStorage(std::in_place_t):
+              TupleLeaf< Is, Args >(std::in_place)...
+            {}
 
-            template < size_t I >
-            constexpr const auto & at() const noexcept
-            {
-                static_assert(I == -1, "Requested tuple index is out of bounds");
-            }
+            template < typename... Us >
+            constexpr TupleStorage(std::in_place_t, Us &&... us):
+              TupleLeaf< Is, Args >(std::in_place, std::forward< Us >(us))...
+            {}
+            TupleStorage(const TupleStorage &) = default;
+            TupleStorage(TupleStorage &&) = default;
+            TupleStorage & operator=(const TupleStorage &) = default;
+            TupleStorage & operator=(TupleStorage &&) = default;
 
-            auto operator<=>(const TupleHead & rhs) const noexcept = default;
+            auto operator<=>(const TupleStorage & rhs) const noexcept = default;
         };
+
+        /// Element type is deduced from the only base with a matching index, so access does not
+        /// recurse over the elements
+        template < size_t I, typename T >
+        constexpr auto & leaf_at(TupleLeaf< I, T > & leaf) noexcept
+        {
+            return leaf.v;
+        }
+
+        template < size_t I, typename T >
+        constexpr const auto & leaf_at(const TupleLeaf< I, T > & leaf) noexcept
+        {
+            return leaf.v;
+        }
+
+        /// Excludes a single argument of the tuple type itself, which is a copy or a move
+        template < typename TupleT, typename... Us >
+        concept NotSelf =
+         sizeof...(Us) != 1 || !(std::is_same_v< std::remove_cvref_t< Us >, TupleT > && ...);
     }
 
+    template < typename... Args >
+    class Tuple;
+
+    template < size_t BEGIN, size_t END, typename TupleT >
+    class BasicTupleView;
+
     template < size_t BEGIN, size_t END, typename... Args >
-    class TupleView;
+    using TupleView = BasicTupleView< BEGIN, END, Tuple< Args... > >;
 
     /// Mostly same as std::tuple, but with some flavour on top: TupleView for complete or partial
     /// iteration
@@ -88,8 +94,23 @@ namespace static_containers
        public:
         using args_as_pack = pack< Args... >;
 
-        Tuple(Args... args):
-          head_(std::forward< Args >(args)...){};
+        constexpr Tuple(const Args &... args):
+          storage_(std::in_place, args...){};
+
+        /// Value-initializes every element in place
+        constexpr Tuple()
+            requires(sizeof...(Args) > 0 && (std::default_initializable< Args > && ...))
+        :
+          storage_(std::in_place)
+        {}
+
+        /// Constructs every element straight from its argument, without an intermediate copy
+        template < typename... Us >
+            requires(sizeof...(Us) == sizeof...(Args) && sizeof...(Args) > 0 &&
+                     detail::NotSelf< Tuple, Us... > &&
+                     (std::constructible_from< Args, Us && > && ...))
+        constexpr Tuple(Us &&... us):
+          storage_(std::in_place, std::forward< Us >(us)...){};
 
         Tuple(const Tuple &) = default;
         Tuple(Tuple &&) = default;
@@ -99,13 +120,15 @@ namespace static_containers
         template < size_t I >
         constexpr auto & at()
         {
-            return head_.template at< I >();
+            static_assert(I < sizeof...(Args), "Requested tuple index is out of bounds");
+            return detail::leaf_at< I >(storage_);
         }
 
         template < size_t I >
         constexpr const auto & at() const
         {
-            return head_.template at< I >();
+            static_assert(I < sizeof...(Args), "Requested tuple index is out of bounds");
+            return detail::leaf_at< I >(storage_);
         }
 
         static constexpr size_t size() noexcept
@@ -126,53 +149,49 @@ namespace static_containers
              .template shrink_back< size() - END_IDX >();
         }
 
-        constexpr auto operator<=>(const Tuple & rhs) const noexcept = default;
+        auto operator<=>(const Tuple & rhs) const noexcept = default;
 
        private:
-        detail::TupleHead< Args... > head_;
+        [[no_unique_address]] detail::TupleStorage< std::index_sequence_for< Args... >,
+         Args... > storage_;
     };
 
-    namespace detail
-    {
-        template < size_t I = 0, typename... Args >
-        constexpr void assign_ref_tuple_impl(Tuple< Args &... > & lhs, Tuple< Args... > rhs)
-        {
-            if constexpr (I < sizeof...(Args))
-            {
-                get< I >(lhs) = get< I >(rhs);
-                assign_ref_tuple_impl< I + 1 >(lhs, rhs);
-            }
-        }
-    }
-
     template < typename... Args >
     class Tuple< Args &... >
     {
        public:
         constexpr Tuple(Args &... args):
-          head_(args...){};
+          storage_(std::in_place, args...){};
 
         Tuple(const Tuple &) = default;
         Tuple(Tuple &&) = default;
         Tuple & operator=(const Tuple &) = default;
         Tuple & operator=(Tuple &&) = default;
 
-        constexpr Tuple & operator=(Tuple< Args... > & rhs)
+        /// Assigns element-wise from any tuple of the same size: Tuple, PackedTuple or a view
+        template < typename TupleT >
+            requires(TupleT::size() == sizeof...(Args))
+        constexpr Tuple & operator=(const TupleT & rhs)
         {
-            detail::assign_ref_tuple_impl(*this, rhs);
+            [&]< size_t... Is >(std::index_sequence< Is... >)
+            {
+                ((at< Is >() = rhs.template at< Is >()), ...);
+            }(std::index_sequence_for< Args... >{});
             return *this;
         }
 
         template < size_t I >
         constexpr auto & at()
         {
-            return head_.template at< I >();
+            static_assert(I < sizeof...(Args), "Requested tuple index is out of bounds");
+            return detail::leaf_at< I >(storage_);
         }
 
         template < size_t I >
         constexpr const auto & at() const
         {
-            return head_.template at< I >();
+            static_assert(I < sizeof...(Args), "Requested tuple index is out of bounds");
+            return detail::leaf_at< I >(storage_);
         }
 
         static constexpr size_t size() noexcept
@@ -180,13 +199,13 @@ namespace static_containers
             return sizeof...(Args);
         }
 
-        constexpr TupleView< 0, sizeof...(Args), Args... > view_full() noexcept
+        constexpr BasicTupleView< 0, sizeof...(Args), Tuple > view_full() noexcept
         {
             return { *this };
         }
 
         template < size_t BEGIN_IDX, size_t END_IDX >
-        constexpr TupleView< BEGIN_IDX, END_IDX, Args... > view() noexcept
+        constexpr BasicTupleView< BEGIN_IDX, END_IDX, Tuple > view() noexcept
         {
             return view_full()
              .template shrink_front< BEGIN_IDX >()
@@ -196,7 +215,8 @@ namespace static_containers
         auto operator<=>(const Tuple & rhs) const noexcept = default;
 
        private:
-        detail::TupleHead< Args &... > head_;
+        [[no_unique_address]] detail::TupleStorage< std::index_sequence_for< Args... >,
+         Args &... > storage_;
     };
 
     template < size_t I, typename... Args >
@@ -211,10 +231,14 @@ namespace static_containers
         return rhs.template at< I >();
     }
 
+    template < typename... Args >
+    Tuple(Args...) -> Tuple< Args... >;
+
+    /// Moves the element out, unless it is a reference: those are passed on as they are
     template < size_t I, typename... Args >
     constexpr auto && get(Tuple< Args... > && rhs)
     {
-        return std::move(rhs.template at< I >());
+        return static_cast< typename ith< I, Args... >::type && >(rhs.template at< I >());
     }
 
     template < typename... Args >
@@ -225,8 +249,15 @@ namespace static_containers
 
     constexpr auto make_tuple = []< typename... Args >(Args &&... args)
     {
-        return Tuple{ std::forward< Args >(args)... };
+        return Tuple< std::decay_t< Args >... >{ std::forward< Args >(args)... };
     };
+
+    /// Tuple of references to args, rvalues stay rvalues
+    template < typename... Args >
+    constexpr Tuple< Args &&... > forward_as_tuple(Args &&... args) noexcept
+    {
+        return Tuple< Args &&... >{ std::forward< Args >(args)... };
+    }
 }
 
 #endif
\ No newline at end of file
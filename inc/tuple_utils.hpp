@@ -1,7 +1,11 @@
 #ifndef TUPLE_UTILS_HPP
 #define TUPLE_UTILS_HPP
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <numeric>
+#include <type_traits>
 #include <utility>
 
 #include "tuple.hpp"
@@ -9,29 +13,30 @@
 namespace static_containers
 {
 
-    template < size_t BEGIN, size_t END, typename... Args >
-    class TupleView
+    /// View over elements [BEGIN, END) of any tuple providing at< I >(): Tuple or PackedTuple
+    template < size_t BEGIN, size_t END, typename TupleT >
+    class BasicTupleView
     {
         static_assert(BEGIN != END);
 
        public:
-        constexpr TupleView(Tuple< Args... > & tuple):
+        constexpr BasicTupleView(TupleT & tuple):
           tuple_(tuple)
         {}
 
-        TupleView(const TupleView &) = default;
-        TupleView(TupleView &&) = default;
-        TupleView & operator=(const TupleView &) = default;
-        TupleView & operator=(TupleView &&) = default;
+        BasicTupleView(const BasicTupleView &) = default;
+        BasicTupleView(BasicTupleView &&) = default;
+        BasicTupleView & operator=(const BasicTupleView &) = default;
+        BasicTupleView & operator=(BasicTupleView &&) = default;
 
         template < size_t N = 1 >
-        constexpr TupleView< BEGIN + N, END, Args... > shrink_front()
+        constexpr BasicTupleView< BEGIN + N, END, TupleT > shrink_front()
         {
             return { tuple_ };
         }
 
         template < size_t N = 1 >
-        constexpr TupleView< BEGIN, END - N, Args... > shrink_back()
+        constexpr BasicTupleView< BEGIN, END - N, TupleT > shrink_back()
         {
             return { tuple_ };
         }
@@ -40,14 +45,14 @@ namespace static_containers
         constexpr auto & at()
         {
             static_assert(BEGIN + I < END);
-            return get< BEGIN + I >(tuple_);
+            return tuple_.template at< BEGIN + I >();
         }
 
         template < size_t I >
         constexpr const auto & at() const
         {
             static_assert(BEGIN + I < END);
-            return get< BEGIN + I >(tuple_);
+            return tuple_.template at< BEGIN + I >();
         }
 
         static constexpr size_t size()
@@ -56,86 +61,104 @@ namespace static_containers
         }
 
        private:
-        Tuple< Args... > & tuple_;
+        TupleT & tuple_;
     };
 
-    template < size_t I, size_t BEGIN, size_t END, typename... Args >
-    constexpr auto & get(TupleView< BEGIN, END, Args... > & rhs)
+    template < size_t I, size_t BEGIN, size_t END, typename TupleT >
+    constexpr auto & get(BasicTupleView< BEGIN, END, TupleT > & rhs)
     {
         return rhs.template at< I >();
     }
 
-    template < size_t I, size_t BEGIN, size_t END, typename... Args >
-    constexpr const auto & get(const TupleView< BEGIN, END, Args... > & rhs)
+    template < size_t I, size_t BEGIN, size_t END, typename TupleT >
+    constexpr const auto & get(const BasicTupleView< BEGIN, END, TupleT > & rhs)
     {
         return rhs.template at< I >();
     }
 
-    template < size_t I, size_t BEGIN, size_t END, typename... Args >
-    constexpr auto && get(TupleView< BEGIN, END, Args... > && rhs)
+    template < size_t I, size_t BEGIN, size_t END, typename TupleT >
+    constexpr auto && get(BasicTupleView< BEGIN, END, TupleT > && rhs)
     {
         return std::move(rhs.template at< I >());
     }
 
-    template < size_t I = 0, typename F, size_t BEGIN, size_t END, typename... Args >
-    void for_each(TupleView< BEGIN, END, Args... > view, F f)
+    template < size_t I = 0, typename F, size_t BEGIN, size_t END, typename TupleT >
+    void for_each(BasicTupleView< BEGIN, END, TupleT > view, F f)
     {
         if constexpr (I < view.size())
         {
             f(get< I >(view));
-            for_each< I + 1, F, BEGIN, END, Args... >(view, f);
+            for_each< I + 1, F, BEGIN, END, TupleT >(view, f);
         }
     }
 
     namespace detail
     {
-        template < typename... Args >
-        struct Unwrapper
+        /// Where every element of the concatenated tuples comes from: tuple_of[K] is the tuple
+        /// of the element K, elem_of[K] is its index inside that tuple
+        template < typename... Tpls >
+        struct FlatIndex
         {
-            template < size_t I = 0, typename F, typename Tpl, typename... Tpls >
-            static constexpr auto unwrap(F && f, Tpl && tpl, Tpls &&... tpls, Args &&... args)
+            static constexpr size_t size = (Tpls::size() + ... + 0);
+
+            static constexpr std::array< size_t, size > tuple_of = []()
+            {
+                std::array< size_t, size > result{};
+                size_t k = 0;
+                size_t tpl = 0;
+                ((std::fill_n(result.begin() + k, Tpls::size(), tpl++), k += Tpls::size()), ...);
+                return result;
+            }();
+
+            static constexpr std::array< size_t, size > elem_of = []()
             {
-                if constexpr (I < std::remove_reference_t< Tpl >::size())
-                {
-                    auto next_arg = get< I >(std::forward< Tpl >(tpl));
-                    using NextArgType = decltype(next_arg);
-                    return Unwrapper< Args...,
-                     NextArgType >::template unwrap< I + 1, F, Tpl, Tpls... >(std::forward< F >(f),
-                     std::forward< Tpl >(tpl),
-                     std::forward< Tpls >(tpls)...,
-                     std::forward< Args >(args)...,
-                     std::forward< NextArgType >(next_arg));
-                }
-                else if constexpr (sizeof...(Tpls) > 0)
-                {
-                    return Unwrapper< Args... >::unwrap< 0, F, Tpls... >(std::forward< F >(f),
-                     std::forward< Tpls >(tpls)...,
-                     std::forward< Args >(args)...);
-                }
-                else
-                {
-                    return f(std::forward< Args >(args)...);
-                }
-            }
+                std::array< size_t, size > result{};
+                size_t k = 0;
+                ((std::iota(result.begin() + k, result.begin() + k + Tpls::size(), size_t(0)),
+                  k += Tpls::size()),
+                 ...);
+                return result;
+            }();
         };
     }
 
+    /// Calls f with the elements of all tpls in a row. Elements are forwarded as get gives them:
+    /// moved out of rvalue tuples, referenced from lvalue ones, never copied
     template < typename F, typename... Tpls >
-    constexpr auto unwrap_then_do(F && f, Tpls &&... tpls)
+    constexpr decltype(auto) unwrap_then_do(F && f, Tpls &&... tpls)
     {
-        return detail::Unwrapper<>::unwrap(std::forward< F >(f), std::forward< Tpls >(tpls)...);
+        using Index = detail::FlatIndex< std::remove_cvref_t< Tpls >... >;
+        detail::ArgRefs< std::index_sequence_for< Tpls... >, Tpls... > refs{ { std::forward< Tpls >(
+         tpls) }... };
+        return [&]< size_t... Ks >(std::index_sequence< Ks... >) -> decltype(auto)
+        {
+            return std::forward< F >(f)(
+             get< Index::elem_of[Ks] >(detail::arg_at< Index::tuple_of[Ks] >(refs))...);
+        }(std::make_index_sequence< Index::size >{});
     }
 
     template < typename... Tpls >
     constexpr auto concat(Tpls &&... tpls)
     {
         return unwrap_then_do(
-         [](auto &&... args)
+         []< typename... Elems >(Elems &&... elems)
          {
-             return Tuple{ std::forward< decltype(args) >(args)... };
+             return Tuple< std::remove_cvref_t< Elems >... >{ std::forward< Elems >(elems)... };
          },
          std::forward< Tpls >(tpls)...);
     }
+
+    /// Same as concat, but the result refers to the elements of tpls instead of copying them
+    template < typename... Tpls >
+    constexpr auto concat_refs(Tpls &... tpls)
+    {
+        return unwrap_then_do(
+         []< typename... Elems >(Elems &... elems)
+         {
+             return Tuple< Elems &... >{ elems... };
+         },
+         tpls...);
+    }
 }
 
 #endif
\ No newline at end of file
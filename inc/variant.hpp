@@ -1,8 +1,8 @@
 #ifndef STCT_VARIANT_HPP
 #define STCT_VARIANT_HPP
 
+#include <array>
 #include <cstddef>
-#include <cstring>
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -10,16 +10,34 @@
 #include <utility>
 #include <variant>
 
+#include "indirect.hpp"
+#include "traits.hpp"
+
 namespace static_containers
 {
     namespace detail
     {
+        /// Storage of exactly one alternative at a time, which one is tracked by the owner. Nothing
+        /// is constructed by default and nothing is destroyed automatically: special members are
+        /// trivial if the alternatives' are, and deleted otherwise, for Variant to take over
         template < typename T, typename... Args >
-        class VariadicUnion
+        union VariadicUnion
         {
            public:
-            VariadicUnion():
-              node_()
+            constexpr VariadicUnion() noexcept
+            {}
+
+            VariadicUnion(const VariadicUnion &) = default;
+            VariadicUnion(VariadicUnion &&) = default;
+            VariadicUnion & operator=(const VariadicUnion &) = default;
+            VariadicUnion & operator=(VariadicUnion &&) = default;
+
+            ~VariadicUnion()
+                requires(std::is_trivially_destructible_v< T > &&
+                         (std::is_trivially_destructible_v< Args > && ...))
+            = default;
+
+            ~VariadicUnion()
             {}
 
             template < size_t I >
@@ -27,63 +45,63 @@ namespace static_containers
             {
                 if constexpr (I == 0)
                 {
-                    return node_.val;
+                    return val_;
                 }
                 else
                 {
-                    return node_.next.template at< I - 1 >();
+                    return next_.template at< I - 1 >();
                 }
             }
 
-            template < typename U, size_t I = 0 >
-            static constexpr size_t find_where() noexcept
+            template < size_t I >
+            constexpr const auto & at() const noexcept
             {
-                if constexpr (std::is_same_v< U, T >)
+                if constexpr (I == 0)
                 {
-                    return I;
+                    return val_;
                 }
                 else
                 {
-                    return VariadicUnion< Args... >::template find_where< U, I + 1 >();
+                    return next_.template at< I - 1 >();
                 }
             }
 
             template < typename U, size_t I = 0 >
-            constexpr size_t set(U val)
+            static constexpr size_t find_where() noexcept
             {
-                if constexpr (std::is_same_v< T, U >)
+                if constexpr (std::is_same_v< U, UnboxedT< T > >)
                 {
-                    node_.val = std::move(val);
                     return I;
                 }
                 else
                 {
-                    return node_.next.template set< U, I + 1 >(std::move(val));
+                    return VariadicUnion< Args... >::template find_where< U, I + 1 >();
                 }
             }
 
            private:
-            union Node
-            {
-                Node()
-                {
-                    std::memset(this, 0, sizeof(Node));
-                }
-
-                ~Node()
-                {}
-
-                T val;
-                VariadicUnion< Args... > next;
-            };
-            Node node_;
+            T val_;
+            VariadicUnion< Args... > next_;
         };
 
         template < typename T >
-        class VariadicUnion< T >
+        union VariadicUnion< T >
         {
            public:
-            VariadicUnion() = default;
+            constexpr VariadicUnion() noexcept
+            {}
+
+            VariadicUnion(const VariadicUnion &) = default;
+            VariadicUnion(VariadicUnion &&) = default;
+            VariadicUnion & operator=(const VariadicUnion &) = default;
+            VariadicUnion & operator=(VariadicUnion &&) = default;
+
+            ~VariadicUnion()
+                requires std::is_trivially_destructible_v< T >
+            = default;
+
+            ~VariadicUnion()
+            {}
 
             template < size_t I >
             constexpr auto & at() noexcept
@@ -92,18 +110,18 @@ namespace static_containers
                 return val_;
             }
 
-            template < typename U, size_t I = 0 >
-            static constexpr size_t find_where() noexcept
+            template < size_t I >
+            constexpr const auto & at() const noexcept
             {
-                static_assert(std::is_same_v< T, U >, "Requested variant type is not present");
-                return I;
+                static_assert(I == 0, "Requested variant index is out of bounds");
+                return val_;
             }
 
             template < typename U, size_t I = 0 >
-            constexpr size_t set(U val)
+            static constexpr size_t find_where() noexcept
             {
-                static_assert(std::is_same_v< T, U >, "Requested variant type is not present");
-                val_ = std::move(val);
+                static_assert(std::is_same_v< UnboxedT< T >, U >,
+                 "Requested variant type is not present");
                 return I;
             }
 
@@ -117,56 +135,236 @@ namespace static_containers
 
     namespace detail
     {
-        template < typename T, typename... Args >
-        T construct_first_defaulted()
+        template < typename T, typename... Ts >
+        concept OneOf = (std::is_same_v< T, Ts > || ...);
+
+        template < typename... Ts >
+        concept AllCopyConstructible = (std::is_copy_constructible_v< Ts > && ...);
+
+        template < typename... Ts >
+        concept AllTriviallyCopyConstructible =
+         AllCopyConstructible< Ts... > && (std::is_trivially_copy_constructible_v< Ts > && ...);
+
+        template < typename... Ts >
+        concept AllMoveConstructible = (std::is_move_constructible_v< Ts > && ...);
+
+        template < typename... Ts >
+        concept AllTriviallyMoveConstructible =
+         AllMoveConstructible< Ts... > && (std::is_trivially_move_constructible_v< Ts > && ...);
+
+        template < typename... Ts >
+        concept AllCopyAssignable =
+         AllCopyConstructible< Ts... > && (std::is_copy_assignable_v< Ts > && ...);
+
+        /// Assignment may switch alternatives, so it is trivial only if destroying and
+        /// constructing them is trivial too
+        template < typename... Ts >
+        concept AllTriviallyCopyAssignable = AllCopyAssignable< Ts... > &&
+         ((std::is_trivially_copy_assignable_v< Ts > &&
+           std::is_trivially_copy_constructible_v< Ts > &&
+           std::is_trivially_destructible_v< Ts >) &&
+          ...);
+
+        template < typename... Ts >
+        concept AllMoveAssignable =
+         AllMoveConstructible< Ts... > && (std::is_move_assignable_v< Ts > && ...);
+
+        template < typename... Ts >
+        concept AllTriviallyMoveAssignable = AllMoveAssignable< Ts... > &&
+         ((std::is_trivially_move_assignable_v< Ts > &&
+           std::is_trivially_move_constructible_v< Ts > &&
+           std::is_trivially_destructible_v< Ts >) &&
+          ...);
+
+        /// Alternative access without the index check, for dispatch which already knows it
+        struct VariantAccess
         {
-            return T{};
-        }
+            template < size_t I, typename VariantT >
+            static constexpr auto & get(VariantT & var)
+            {
+                return unbox(var.union_.template at< I >());
+            }
+        };
     }
 
-    /// Same as std::variant for now. Maybe worse.
+    /// Same as std::variant for now. Maybe worse. Copies, moves and destruction are trivial when
+    /// they are for every alternative, so a Variant of trivial types is trivially copyable.
+    /// An Indirect< T > alternative is stored out of line and seen as T by access and visit
     template < typename... Args >
     class Variant
     {
         using UnionT = detail::VariadicUnion< Args... >;
 
        public:
-        constexpr Variant():
-          selected_(0),
-          union_()
+        constexpr Variant()
         {
-            union_.set(detail::construct_first_defaulted< Args... >());
+            construct< 0 >();
         }
 
+        /// Alternative of the very type of val, constructed from it in place
         template < typename T >
-        Variant(T val):
-          selected_(UnionT::template find_where< T >()),
-          union_()
+            requires detail::OneOf< std::remove_cvref_t< T >, detail::UnboxedT< Args >... >
+        Variant(T && val)
+        {
+            construct< UnionT::template find_where< std::remove_cvref_t< T > >() >(
+             std::forward< T >(val));
+        }
+
+        template < size_t I, typename... Us >
+        explicit Variant(std::in_place_index_t< I >, Us &&... us)
         {
-            union_.set(std::move(val));
+            construct< I >(std::forward< Us >(us)...);
         }
 
-        Variant(const Variant &) = default;
-        Variant(Variant &&) = default;
-        Variant & operator=(const Variant &) = default;
-        Variant & operator=(Variant &&) = default;
+        template < typename T, typename... Us >
+        explicit Variant(std::in_place_type_t< T >, Us &&... us):
+          Variant(std::in_place_index< UnionT::template find_where< T >() >,
+           std::forward< Us >(us)...)
+        {}
 
-        ~Variant()
+        Variant(const Variant &)
+            requires detail::AllTriviallyCopyConstructible< Args... >
+        = default;
+
+        Variant(const Variant & rhs)
+            requires detail::AllCopyConstructible< Args... >
+        {
+            rhs.with_index(
+             [&](auto i)
+             {
+                 construct< i >(rhs.union_.template at< i >());
+             });
+        }
+
+        Variant(Variant &&)
+            requires detail::AllTriviallyMoveConstructible< Args... >
+        = default;
+
+        Variant(Variant && rhs) noexcept((std::is_nothrow_move_constructible_v< Args > && ...))
+            requires detail::AllMoveConstructible< Args... >
         {
-            visit(*this,
-             [](auto & elem)
+            rhs.with_index(
+             [&](auto i)
              {
-                 std::destroy_at(std::addressof(elem));
+                 construct< i >(std::move(rhs.union_.template at< i >()));
              });
         }
 
+        Variant & operator=(const Variant &)
+            requires detail::AllTriviallyCopyAssignable< Args... >
+        = default;
+
+        /// Same alternative is assigned in place, another one is copied aside first, so that a
+        /// throwing copy leaves this as it was
+        Variant & operator=(const Variant & rhs)
+            requires detail::AllCopyAssignable< Args... >
+        {
+            if (selected_ == rhs.selected_)
+            {
+                with_index(
+                 [&](auto i)
+                 {
+                     union_.template at< i >() = rhs.union_.template at< i >();
+                 });
+            }
+            else
+            {
+                *this = Variant(rhs);
+            }
+            return *this;
+        }
+
+        Variant & operator=(Variant &&)
+            requires detail::AllTriviallyMoveAssignable< Args... >
+        = default;
+
+        /// Same alternative is move assigned in place, another one goes through emplace, so that a
+        /// throwing move leaves this as it was
+        Variant & operator=(Variant && rhs) noexcept(
+         ((std::is_nothrow_move_constructible_v< Args > &&
+           std::is_nothrow_move_assignable_v< Args >) &&
+          ...))
+            requires detail::AllMoveAssignable< Args... >
+        {
+            if (selected_ == rhs.selected_)
+            {
+                with_index(
+                 [&](auto i)
+                 {
+                     union_.template at< i >() = std::move(rhs.union_.template at< i >());
+                 });
+            }
+            else
+            {
+                rhs.with_index(
+                 [&](auto i)
+                 {
+                     emplace< i >(std::move(rhs.union_.template at< i >()));
+                 });
+            }
+            return *this;
+        }
+
+        ~Variant()
+            requires(std::is_trivially_destructible_v< Args > && ...)
+        = default;
+
+        ~Variant()
+        {
+            destroy();
+        }
+
+        /// Assigns val to the active alternative if it is of the same type, emplaces it otherwise,
+        /// going through a temporary if copying or moving val may throw
         template < typename T >
-        Variant & operator=(T val)
+            requires detail::OneOf< std::remove_cvref_t< T >, detail::UnboxedT< Args >... >
+        Variant & operator=(T && val)
         {
-            selected_ = union_.template set(std::move(val));
+            constexpr size_t I = UnionT::template find_where< std::remove_cvref_t< T > >();
+            if (selected_ == I)
+            {
+                // not through unbox: a moved-from Indirect has no T to assign to, but takes val
+                union_.template at< I >() = std::forward< T >(val);
+            }
+            else
+            {
+                emplace< I >(std::forward< T >(val));
+            }
             return *this;
         }
 
+        /// Destroys the active alternative and constructs alternative I from us in its place. A
+        /// construction which may throw is done aside first and then moved in, so that it leaves
+        /// the variant as it was: Variant has no valueless state to fall back to. That costs a
+        /// temporary and a move, and a move which throws then terminates
+        template < size_t I, typename... Us >
+        auto & emplace(Us &&... us)
+        {
+            using T = ith< I, Args... >::type;
+            if constexpr (std::is_nothrow_constructible_v< T, Us &&... >)
+            {
+                destroy();
+                construct< I >(std::forward< Us >(us)...);
+            }
+            else
+            {
+                T value(std::forward< Us >(us)...);
+                destroy();
+                // nothing would be alive if this threw, so it terminates instead
+                [&]() noexcept
+                {
+                    construct< I >(std::move(value));
+                }();
+            }
+            return detail::unbox(union_.template at< I >());
+        }
+
+        template < typename T, typename... Us >
+        auto & emplace(Us &&... us)
+        {
+            return emplace< UnionT::template find_where< T >() >(std::forward< Us >(us)...);
+        }
+
         constexpr size_t index() const noexcept
         {
             return selected_;
@@ -193,7 +391,18 @@ namespace static_containers
                 throw std::bad_variant_access{};
             }
             constexpr size_t I = UnionT::template find_where< U >();
-            return union_.template at< I >();
+            return detail::unbox(union_.template at< I >());
+        }
+
+        template < typename U >
+        constexpr const auto & at_t() const
+        {
+            if (!holds< U >())
+            {
+                throw std::bad_variant_access{};
+            }
+            constexpr size_t I = UnionT::template find_where< U >();
+            return detail::unbox(union_.template at< I >());
         }
 
         template < size_t I >
@@ -203,10 +412,53 @@ namespace static_containers
             {
                 throw std::bad_variant_access{};
             }
-            return union_.template at< I >();
+            return detail::unbox(union_.template at< I >());
+        }
+
+        template < size_t I >
+        constexpr const auto & at() const
+        {
+            if (selected_ != I)
+            {
+                throw std::bad_variant_access{};
+            }
+            return detail::unbox(union_.template at< I >());
         }
 
        private:
+        friend detail::VariantAccess;
+
+        /// Makes I the active alternative. Whatever was active before must be destroyed already
+        template < size_t I, typename... Us >
+        constexpr void construct(Us &&... us)
+        {
+            std::construct_at(std::addressof(union_.template at< I >()), std::forward< Us >(us)...);
+            selected_ = I;
+        }
+
+        void destroy() noexcept
+        {
+            with_index(
+             [this](auto i)
+             {
+                 std::destroy_at(std::addressof(union_.template at< i >()));
+             });
+        }
+
+        /// Calls f with std::integral_constant of the active index, through a jump table
+        template < typename F >
+        void with_index(F && f) const
+        {
+            static constexpr auto table = []< size_t... Is >(std::index_sequence< Is... >)
+            {
+                return std::array< void (*)(F &), sizeof...(Args) >{ [](F & f)
+                    {
+                        f(std::integral_constant< size_t, Is >{});
+                    }... };
+            }(std::index_sequence_for< Args... >{});
+            table[selected_](f);
+        }
+
         unsigned char selected_;
         UnionT union_;
     };
@@ -217,41 +469,105 @@ namespace static_containers
         return var.template at_t< T >();
     }
 
+    template < typename T, typename... Args >
+    const auto & get(const Variant< Args... > & var)
+    {
+        return var.template at_t< T >();
+    }
+
     template < size_t I, typename... Args >
     auto & get(Variant< Args... > & var)
     {
         return var.template at< I >();
     }
 
+    template < size_t I, typename... Args >
+    const auto & get(const Variant< Args... > & var)
+    {
+        return var.template at< I >();
+    }
+
     namespace detail
     {
-        template < size_t I = 0, typename F, typename... Args >
-        auto visit_impl(Variant< Args... > & var, F & f)
+        template < typename T >
+        struct IsVariant: std::false_type
+        {};
+
+        template < typename... Args >
+        struct IsVariant< Variant< Args... > >: std::true_type
+        {};
+
+        template < typename T >
+        concept AnyVariant = IsVariant< std::remove_cv_t< T > >::value;
+
+        /// Dispatch of f over the alternatives of all vars at once. Every combination of
+        /// alternatives gets an entry in one table, at the mixed-radix number whose digits are the
+        /// indices of the alternatives, most significant first
+        template < typename F, typename... Vars >
+        struct MultiVisit
         {
-            if constexpr (I < Variant< Args... >::alternatives())
+            static constexpr size_t COMBINATIONS = (Vars::alternatives() * ... * 1);
+
+            static constexpr std::array< size_t, sizeof...(Vars) > digits(size_t combined) noexcept
             {
-                switch (var.index())
+                constexpr std::array< size_t, sizeof...(Vars) > radix = { Vars::alternatives()... };
+                std::array< size_t, sizeof...(Vars) > result{};
+                for (size_t i = result.size(); i-- > 0;)
                 {
-                case I:
-                    return f(get< I >(var));
-                default:
-                    return visit_impl< I + 1, F, Args... >(var, f);
+                    result[i] = combined % radix[i];
+                    combined /= radix[i];
                 }
+                return result;
             }
-            else
+
+            template < size_t K, size_t... Vs >
+            static auto result_of(std::index_sequence< Vs... >)
+             -> decltype(std::declval< F & >()(
+              VariantAccess::get< digits(K)[Vs] >(std::declval< Vars & >())...));
+
+            template < size_t... Ks >
+            static auto common_result(std::index_sequence< Ks... >) -> std::common_type_t<
+             decltype(result_of< Ks >(std::index_sequence_for< Vars... >{}))... >;
+
+            using Result = decltype(common_result(std::make_index_sequence< COMBINATIONS >{}));
+
+            template < size_t K >
+            static Result call(F & f, Vars &... vars)
             {
-                throw std::bad_variant_access{};
-                // a trick to outwit return type deduction
-                return visit_impl< I - 1, F, Args... >(var, f);
+                return [&]< size_t... Vs >(std::index_sequence< Vs... >) -> Result
+                {
+                    return f(VariantAccess::get< digits(K)[Vs] >(vars)...);
+                }(std::index_sequence_for< Vars... >{});
             }
-        }
+
+            static constexpr auto table = []< size_t... Ks >(std::index_sequence< Ks... >)
+            {
+                return std::array< Result (*)(F &, Vars &...), COMBINATIONS >{ &call< Ks >... };
+            }(std::make_index_sequence< COMBINATIONS >{});
+
+            static Result visit(F & f, Vars &... vars)
+            {
+                size_t combined = 0;
+                ((combined = combined * Vars::alternatives() + vars.index()), ...);
+                return table[combined](f, vars...);
+            }
+        };
+    }
+
+    /// Calls f with the active alternatives of all vars through a single indirect call. Results
+    /// of the different combinations are converted to their common type
+    template < typename F, typename... Vars >
+        requires(sizeof...(Vars) > 0 && (detail::AnyVariant< Vars > && ...))
+    auto visit(F && f, Vars &... vars)
+    {
+        return detail::MultiVisit< std::remove_reference_t< F >, Vars... >::visit(f, vars...);
     }
 
-    template < typename F, typename... Args >
-    auto visit(Variant< Args... > & var, F f)
+    template < detail::AnyVariant VariantT, typename F >
+    auto visit(VariantT & var, F f)
     {
-        return detail::visit_impl(var, f);
+        return visit(f, var);
     }
 }
 
-#endif
\ No newline at end of file
+#endif
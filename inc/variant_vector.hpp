@@ -0,0 +1,375 @@
+#ifndef STCT_VARIANT_VECTOR_HPP
+#define STCT_VARIANT_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+#include "variant.hpp"
+#include "vector.hpp"
+
+namespace static_containers
+{
+    /// Element of a VariantVector: its alternative, its slot and the generation of that slot, so a
+    /// handle to an erased element does not reach whatever took its slot later. Generations wrap
+    /// after 2^32 erasures from one slot, past which a stale handle could match again
+    struct VariantHandle
+    {
+        std::uint32_t slot;
+        std::uint32_t generation;
+        std::uint16_t type;
+
+        auto operator<=>(const VariantHandle &) const noexcept = default;
+    };
+
+    enum class SegmentOrder
+    {
+        /// Erasure moves the last element of a segment into the gap
+        Unordered,
+        /// Erasure shifts the tail of a segment, elements remember when they were inserted
+        Insertion,
+    };
+
+    namespace detail
+    {
+        struct NoSequence
+        {};
+
+        /// Elements of one alternative, packed densely. Slots map handles onto positions:
+        /// slot_of_ is a permutation of the slots in use, live ones first, then the free ones
+        template < typename T, size_t N, SegmentOrder ORDER >
+        class Segment
+        {
+            static_assert(N <= std::numeric_limits< std::uint32_t >::max(),
+             "Segment slots are 32 bit");
+
+           public:
+            /// Leaves the slot tables uninitialized, they are only read once written
+            Segment() noexcept
+            {}
+
+            template < typename... Us >
+            VariantHandle emplace(std::uint16_t type, std::uint64_t sequence, Us &&... us)
+            {
+                assert(values_.size() < N);
+                size_t dense = values_.size();
+                values_.emplace_back(std::forward< Us >(us)...);
+                std::uint32_t slot;
+                if (dense < used_)
+                {
+                    slot = slot_of_[dense];
+                }
+                else
+                {
+                    slot = used_++;
+                    generation_[slot] = 0;
+                    slot_of_[dense] = slot;
+                }
+                dense_of_[slot] = static_cast< std::uint32_t >(dense);
+                if constexpr (ORDER == SegmentOrder::Insertion)
+                {
+                    sequence_[dense] = sequence;
+                }
+                return { slot, generation_[slot], type };
+            }
+
+            T * find(VariantHandle handle) noexcept
+            {
+                if (handle.slot >= used_ || generation_[handle.slot] != handle.generation)
+                {
+                    return nullptr;
+                }
+                return std::addressof(values_[dense_of_[handle.slot]]);
+            }
+
+            bool erase(VariantHandle handle)
+            {
+                if (find(handle) == nullptr)
+                {
+                    return false;
+                }
+                ++generation_[handle.slot];
+                size_t dense = dense_of_[handle.slot];
+                size_t last = values_.size() - 1;
+                if constexpr (ORDER == SegmentOrder::Unordered)
+                {
+                    if (dense != last)
+                    {
+                        values_[dense] = std::move(values_[last]);
+                        relocate(last, dense);
+                    }
+                }
+                else
+                {
+                    std::move(values_.begin() + dense + 1, values_.end(), values_.begin() + dense);
+                    for (size_t i = dense; i < last; ++i)
+                    {
+                        relocate(i + 1, i);
+                        sequence_[i] = sequence_[i + 1];
+                    }
+                }
+                slot_of_[last] = handle.slot;
+                values_.pop_back();
+                return true;
+            }
+
+            void clear() noexcept
+            {
+                for (size_t dense = 0; dense < values_.size(); ++dense)
+                {
+                    ++generation_[slot_of_[dense]];
+                }
+                values_.clear();
+            }
+
+            Vector< T, N > & values() noexcept
+            {
+                return values_;
+            }
+
+            const Vector< T, N > & values() const noexcept
+            {
+                return values_;
+            }
+
+            std::uint64_t sequence(size_t dense) const noexcept
+                requires(ORDER == SegmentOrder::Insertion)
+            {
+                return sequence_[dense];
+            }
+
+           private:
+            void relocate(size_t from, size_t to) noexcept
+            {
+                slot_of_[to] = slot_of_[from];
+                dense_of_[slot_of_[to]] = static_cast< std::uint32_t >(to);
+            }
+
+            using Sequences = std::conditional_t< ORDER == SegmentOrder::Insertion,
+             std::array< std::uint64_t, N >,
+             NoSequence >;
+
+            Vector< T, N > values_;
+            std::uint32_t used_ = 0;
+            std::array< std::uint32_t, N > slot_of_;
+            std::array< std::uint32_t, N > dense_of_;
+            std::array< std::uint32_t, N > generation_;
+            [[no_unique_address]] Sequences sequence_;
+        };
+    }
+
+    /// Up to N elements of each alternative, kept in one contiguous Vector per alternative, so that
+    /// for_each runs segment by segment with no dispatch per element and no padding up to the
+    /// largest alternative. Elements are reached through VariantHandle, which stays valid until
+    /// the element is erased
+    template < SegmentOrder ORDER, size_t N, typename... Args >
+    class BasicVariantVector
+    {
+        static_assert(sizeof...(Args) <= std::numeric_limits< std::uint16_t >::max());
+
+        using Segments = Tuple< detail::Segment< Args, N, ORDER >... >;
+
+       public:
+        /// Leaves the storage alone, so a big one costs nothing up front
+        BasicVariantVector() noexcept
+        {}
+
+        template < typename T, typename... Us >
+        VariantHandle emplace(Us &&... us)
+        {
+            constexpr size_t I = index_of< T >();
+            return segments_.template at< I >().emplace(static_cast< std::uint16_t >(I),
+             next_sequence_++,
+             std::forward< Us >(us)...);
+        }
+
+        template < typename T >
+            requires detail::OneOf< std::remove_cvref_t< T >, Args... >
+        VariantHandle push_back(T && value)
+        {
+            return emplace< std::remove_cvref_t< T > >(std::forward< T >(value));
+        }
+
+        /// Element behind handle if it is still there and is a T, nullptr otherwise
+        template < typename T >
+        T * find(VariantHandle handle) noexcept
+        {
+            constexpr size_t I = index_of< T >();
+            return handle.type == I ? segments_.template at< I >().find(handle) : nullptr;
+        }
+
+        template < typename T >
+        const T * find(VariantHandle handle) const noexcept
+        {
+            return const_cast< BasicVariantVector & >(*this).template find< T >(handle);
+        }
+
+        bool contains(VariantHandle handle) const noexcept
+        {
+            bool result = false;
+            const_cast< BasicVariantVector & >(*this).with_segment(handle.type,
+             [&](auto & segment)
+             {
+                 result = segment.find(handle) != nullptr;
+             });
+            return result;
+        }
+
+        /// Calls f with the element behind handle. Returns false if there is none
+        template < typename F >
+        bool visit(VariantHandle handle, F && f)
+        {
+            bool found = false;
+            with_segment(handle.type,
+             [&](auto & segment)
+             {
+                 if (auto * element = segment.find(handle))
+                 {
+                     found = true;
+                     f(*element);
+                 }
+             });
+            return found;
+        }
+
+        bool erase(VariantHandle handle)
+        {
+            bool erased = false;
+            with_segment(handle.type,
+             [&](auto & segment)
+             {
+                 erased = segment.erase(handle);
+             });
+            return erased;
+        }
+
+        void clear() noexcept
+        {
+            static_containers::for_each(segments_.view_full(),
+             [](auto & segment)
+             {
+                 segment.clear();
+             });
+        }
+
+        size_t size() const noexcept
+        {
+            return [&]< size_t... Is >(std::index_sequence< Is... >)
+            {
+                return (segments_.template at< Is >().values().size() + ... + 0);
+            }(std::index_sequence_for< Args... >{});
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        static constexpr size_t capacity_per_alternative() noexcept
+        {
+            return N;
+        }
+
+        /// All elements of alternative T, contiguous
+        template < typename T >
+        const Vector< T, N > & segment() const noexcept
+        {
+            return segments_.template at< index_of< T >() >().values();
+        }
+
+        /// Calls f with every element, alternative by alternative
+        template < typename F >
+        void for_each(F && f)
+        {
+            static_containers::for_each(segments_.view_full(),
+             [&](auto & segment)
+             {
+                 for (auto & element: segment.values())
+                 {
+                     f(element);
+                 }
+             });
+        }
+
+        /// Calls f with every element in the order of insertion: a merge of the segments, which
+        /// are each sorted already
+        template < typename F >
+        void for_each_ordered(F && f)
+            requires(ORDER == SegmentOrder::Insertion)
+        {
+            std::array< size_t, sizeof...(Args) > cursors{};
+            for (size_t left = size(); left > 0; --left)
+            {
+                size_t oldest = 0;
+                std::uint64_t oldest_sequence = std::numeric_limits< std::uint64_t >::max();
+                [&]< size_t... Is >(std::index_sequence< Is... >)
+                {
+                    (
+                     [&]()
+                     {
+                         const auto & segment = segments_.template at< Is >();
+                         if (cursors[Is] < segment.values().size() &&
+                             segment.sequence(cursors[Is]) < oldest_sequence)
+                         {
+                             oldest = Is;
+                             oldest_sequence = segment.sequence(cursors[Is]);
+                         }
+                     }(),
+                     ...);
+                }(std::index_sequence_for< Args... >{});
+                with_segment(oldest,
+                 [&](auto & segment)
+                 {
+                     f(segment.values()[cursors[oldest]++]);
+                 });
+            }
+        }
+
+       private:
+        template < typename T >
+        static constexpr size_t index_of() noexcept
+        {
+            return detail::VariadicUnion< Args... >::template find_where< T >();
+        }
+
+        /// Calls f with segment type, through a jump table. A handle may carry any type, so one
+        /// out of range calls nothing and its element is not found, as that of a stale handle
+        template < typename F >
+        void with_segment(size_t type, F && f)
+        {
+            if (type >= sizeof...(Args))
+            {
+                return;
+            }
+            static constexpr auto table = []< size_t... Is >(std::index_sequence< Is... >)
+            {
+                return std::array< void (*)(F &, Segments &), sizeof...(Args) >{
+                    [](F & f, Segments & segments)
+                    {
+                        f(segments.template at< Is >());
+                    }...
+                };
+            }(std::index_sequence_for< Args... >{});
+            table[type](f, segments_);
+        }
+
+        Segments segments_;
+        std::uint64_t next_sequence_ = 0;
+    };
+
+    template < size_t N, typename... Args >
+    using VariantVector = BasicVariantVector< SegmentOrder::Unordered, N, Args... >;
+
+    template < size_t N, typename... Args >
+    using OrderedVariantVector = BasicVariantVector< SegmentOrder::Insertion, N, Args... >;
+}
+
+#endif
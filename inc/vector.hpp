@@ -6,6 +6,7 @@
 #include <bits/ranges_base.h>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
@@ -13,7 +14,6 @@
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
-#include <vector>
 
 namespace static_containers
 {
@@ -32,7 +32,7 @@ namespace static_containers
         using Iterator = T *;
         using ConstIterator = const T *;
         using ReverseIterator = std::reverse_iterator< T * >;
-        using ConstReverseIterator = std::reverse_iterator< T * >;
+        using ConstReverseIterator = std::reverse_iterator< const T * >;
 
         constexpr Vector() noexcept:
           size_(0)
@@ -73,29 +73,40 @@ namespace static_containers
         }
 
         constexpr Vector(Vector && rhs):
-          size_(rhs.size_)
+          Vector()
         {
             assign(rhs.begin(), rhs.end());
-            rhs.size_ = 0;
+            rhs.clear();
         }
 
         constexpr Vector & operator=(std::initializer_list< T > init)
         {
-            Vector tmp{ std::move(init) };
-            std::swap(*this, tmp);
+            clear();
+            assign(init);
             return *this;
         }
 
         constexpr Vector & operator=(const Vector & rhs)
         {
-            Vector tmp{ rhs };
-            std::swap(*this, tmp);
+            if (this != std::addressof(rhs))
+            {
+                clear();
+                for (const auto & item: rhs)
+                {
+                    push_back(item);
+                }
+            }
             return *this;
         }
 
         constexpr Vector & operator=(Vector && rhs)
         {
-            std::swap(*this, rhs);
+            if (this != std::addressof(rhs))
+            {
+                clear();
+                assign(rhs.begin(), rhs.end());
+                rhs.clear();
+            }
             return *this;
         }
 
@@ -223,32 +234,32 @@ namespace static_containers
 
         constexpr ReverseIterator rbegin() noexcept
         {
-            return end();
+            return ReverseIterator(end());
         }
 
         constexpr ConstReverseIterator rbegin() const noexcept
         {
-            return end();
+            return ConstReverseIterator(end());
         }
 
         constexpr ConstReverseIterator crbegin() const noexcept
         {
-            return cend();
+            return ConstReverseIterator(cend());
         }
 
         constexpr ReverseIterator rend() noexcept
         {
-            return begin();
+            return ReverseIterator(begin());
         }
 
         constexpr ConstReverseIterator rend() const noexcept
         {
-            return begin();
+            return ConstReverseIterator(begin());
         }
 
         constexpr ConstReverseIterator crend() const noexcept
         {
-            return cbegin();
+            return ConstReverseIterator(cbegin());
         }
 
         [[nodiscard]] constexpr bool empty() const noexcept
@@ -336,8 +347,22 @@ namespace static_containers
 
         constexpr Iterator insert(ConstIterator pos, SizeType count, const T & value) noexcept
         {
-            std::vector< T > to_insert(count, value);
-            return insert(pos, to_insert.begin(), to_insert.end());
+            assert(size_ + count <= capacity());
+
+            // value may live in the very range being shifted
+            const T * src = std::addressof(value);
+            if (src >= pos && src < cend())
+            {
+                src += count;
+            }
+            auto pos_idx = pos - begin();
+            open_gap(pos_idx, count);
+            for (SizeType i = pos_idx; i != pos_idx + count; ++i)
+            {
+                construct_at(i, *src);
+            }
+            size_ += count;
+            return begin() + pos_idx;
         }
 
         template < std::input_iterator It >
@@ -347,8 +372,8 @@ namespace static_containers
 
             assert(size_ + amount_to_insert <= capacity());
 
-            shift_elems(amount_to_insert, end() - 1, std::distance(pos, cend()));
             auto pos_idx = pos - begin();
+            open_gap(pos_idx, amount_to_insert);
             for (SizeType i = pos_idx; i != pos_idx + amount_to_insert; ++first, ++i)
             {
                 construct_at(i, std::move(*first));
@@ -366,8 +391,8 @@ namespace static_containers
         constexpr Iterator emplace(ConstIterator pos, Args &&... args)
         {
             assert(size_ + 1 <= capacity());
-            shift_elems(1, end() - 1, std::distance(pos, cend()));
             auto pos_idx = pos - begin();
+            open_gap(pos_idx, 1);
             construct_at(pos_idx, std::forward< Args >(args)...);
             ++size_;
             return begin() + pos_idx;
@@ -375,44 +400,70 @@ namespace static_containers
 
         constexpr Iterator erase(ConstIterator pos)
         {
-            auto pos_mut = begin() + (pos - begin());
-            std::destroy_at(pos_mut);
-            shift_elems(-1, pos_mut + 1, std::distance(pos_mut, end()));
-            --size_;
-            return pos_mut;
+            auto pos_idx = pos - begin();
+            std::destroy_at(begin() + pos_idx);
+            close_gap(pos_idx, 1);
+            return begin() + pos_idx;
         }
 
         constexpr Iterator erase(ConstIterator first, ConstIterator last)
         {
-            auto first_mut = begin() + (first - begin());
-            auto last_mut = begin() + (last - begin());
+            auto first_idx = first - begin();
             auto count = std::distance(first, last);
-            std::destroy(first_mut, last_mut);
-            shift_elems(-count, last_mut, std::distance(first_mut, end()));
-            size_ -= count;
-            return first_mut;
+            std::destroy(begin() + first_idx, begin() + first_idx + count);
+            close_gap(first_idx, count);
+            return begin() + first_idx;
         }
 
        private:
         template < typename... Args >
-        constexpr void construct_at(SizeType pos, Args... args)
+        constexpr void construct_at(SizeType pos, Args &&... args)
         {
             assert(pos < N);
             ::new (std::addressof(storage_[pos])) T(std::forward< Args >(args)...);
         }
 
-        constexpr static void shift_elems(DifferenceType shift, Iterator from, SizeType count)
+        /// Moves the elements from pos on count places up, leaving raw storage behind them. Each
+        /// element is relocated: trivially copyable ones all at once, others one by one with a
+        /// move and a destruction
+        constexpr void open_gap(SizeType pos, SizeType count)
+        {
+            assert(size_ + count <= N);
+            if constexpr (std::is_trivially_copyable_v< T >)
+            {
+                std::memmove(static_cast< void * >(begin() + pos + count),
+                 begin() + pos,
+                 (size_ - pos) * sizeof(T));
+            }
+            else
+            {
+                for (SizeType i = size_; i-- > pos;)
+                {
+                    construct_at(i + count, std::move((*this)[i]));
+                    std::destroy_at(begin() + i);
+                }
+            }
+        }
+
+        /// Inverse of open_gap: count elements from pos on are already destroyed, the ones
+        /// past them move down to fill the gap
+        constexpr void close_gap(SizeType pos, SizeType count)
         {
-            auto sign = [](auto num)
+            if constexpr (std::is_trivially_copyable_v< T >)
             {
-                return (num > 0) - (num < 0);
-            };
-            DifferenceType inc = -sign(shift);
-            Iterator to = from + shift;
-            for (SizeType i = 0; i < count; from += inc, to += inc, ++i)
+                std::memmove(static_cast< void * >(begin() + pos),
+                 begin() + pos + count,
+                 (size_ - pos - count) * sizeof(T));
+            }
+            else
             {
-                *to = std::move(*from);
+                for (SizeType i = pos + count; i < size_; ++i)
+                {
+                    construct_at(i - count, std::move((*this)[i]));
+                    std::destroy_at(begin() + i);
+                }
             }
+            size_ -= count;
         }
 
         SizeType size_;
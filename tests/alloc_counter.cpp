@@ -0,0 +1,139 @@
+#include "alloc_counter.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local size_t allocations = 0;
+    thread_local size_t deallocations = 0;
+
+    void * allocate(size_t size)
+    {
+        ++allocations;
+        if (void * ptr = std::malloc(size == 0 ? 1 : size))
+        {
+            return ptr;
+        }
+        throw std::bad_alloc{};
+    }
+
+    void * allocate(size_t size, std::align_val_t align)
+    {
+        ++allocations;
+        auto alignment = static_cast< size_t >(align);
+        size = (size + alignment - 1) / alignment * alignment;
+        if (void * ptr = std::aligned_alloc(alignment, size == 0 ? alignment : size))
+        {
+            return ptr;
+        }
+        throw std::bad_alloc{};
+    }
+
+    void deallocate(void * ptr) noexcept
+    {
+        if (ptr != nullptr)
+        {
+            ++deallocations;
+            std::free(ptr);
+        }
+    }
+}
+
+namespace static_containers::testing
+{
+    size_t allocations_on_thread() noexcept
+    {
+        return allocations;
+    }
+
+    size_t deallocations_on_thread() noexcept
+    {
+        return deallocations;
+    }
+}
+
+void * operator new(size_t size)
+{
+    return allocate(size);
+}
+
+void * operator new[](size_t size)
+{
+    return allocate(size);
+}
+
+void * operator new(size_t size, std::align_val_t align)
+{
+    return allocate(size, align);
+}
+
+void * operator new[](size_t size, std::align_val_t align)
+{
+    return allocate(size, align);
+}
+
+void * operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return nullptr;
+    }
+}
+
+void * operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void * ptr) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void * ptr, size_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete(void * ptr, size_t, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void * ptr, size_t, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
@@ -0,0 +1,42 @@
+#ifndef TEST_ALLOC_COUNTER_HPP
+#define TEST_ALLOC_COUNTER_HPP
+
+#include <cstddef>
+
+namespace static_containers::testing
+{
+    /// Totals of replaced global operator new/delete calls made by the calling thread. Defined in
+    /// alloc_counter.cpp, which has to be linked into the executable for the replacement to happen
+    size_t allocations_on_thread() noexcept;
+    size_t deallocations_on_thread() noexcept;
+
+    /// Heap traffic of the calling thread since the scope was entered. Check results once the
+    /// scope is done with: assertion machinery may allocate on its own
+    class AllocationScope
+    {
+       public:
+        AllocationScope() noexcept:
+          allocations_(allocations_on_thread()),
+          deallocations_(deallocations_on_thread())
+        {}
+
+        AllocationScope(const AllocationScope &) = delete;
+        AllocationScope & operator=(const AllocationScope &) = delete;
+
+        size_t allocations() const noexcept
+        {
+            return allocations_on_thread() - allocations_;
+        }
+
+        size_t deallocations() const noexcept
+        {
+            return deallocations_on_thread() - deallocations_;
+        }
+
+       private:
+        size_t allocations_;
+        size_t deallocations_;
+    };
+}
+
+#endif
@@ -0,0 +1,220 @@
+#include "fwd.hpp"
+#include "map.hpp"
+#include "tuple.hpp"
+#include "tuple_utils.hpp"
+#include "variant.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "alloc_counter.hpp"
+#include "drop_logger.hpp"
+
+namespace stct = static_containers;
+
+TEST_CASE("allocation counter sees heap")
+{
+    stct::testing::AllocationScope scope;
+    delete new int(1);
+    auto allocations = scope.allocations();
+    auto deallocations = scope.deallocations();
+    REQUIRE(allocations == 1);
+    REQUIRE(deallocations == 1);
+}
+
+TEST_CASE("vector is allocation free")
+{
+    using stct::testing::DropLogger;
+    using VecT = stct::Vector< int, 64 >;
+    size_t destructed = 0;
+    size_t sum = 0;
+
+    stct::testing::AllocationScope scope;
+    {
+        VecT vec{ 1, 2, 3 };
+        VecT copy(vec);
+        VecT moved(std::move(copy));
+        VecT counted(4, 7);
+        VecT defaulted(4);
+        VecT ranged(vec.begin(), vec.end());
+        copy = vec;
+        moved = std::move(ranged);
+        counted = { 5, 6 };
+
+        vec.assign(8, 1);
+        vec.assign(counted.begin(), counted.end());
+        vec.assign({ 9, 10 });
+        vec.push_back(11);
+        vec.emplace_back(12);
+        vec.pop_back();
+        vec.insert(vec.begin() + 1, 13);
+        vec.insert(vec.begin() + 1, sum);
+        vec.insert(vec.begin() + 2, 5, 14);
+        vec.insert(vec.begin() + 2, 3, vec[4]);
+        vec.insert(vec.begin(), { 15, 16 });
+        vec.insert(vec.end(), counted.begin(), counted.end());
+        vec.emplace(vec.begin() + 3, 17);
+        vec.erase(vec.begin());
+        vec.erase(vec.begin() + 1, vec.begin() + 3);
+        vec.resize(30, 18);
+        vec.resize(10);
+        sum += vec.at(0) + vec[0] + vec.front() + vec.back() + *vec.data() + vec.size();
+        sum += std::count(vec.rbegin(), vec.rend(), 1);
+        sum += vec == copy;
+        sum += std::is_lt(vec <=> copy);
+        stct::erase(vec, 14);
+        stct::erase_if(vec,
+         [](int elem)
+         {
+             return elem % 2 == 0;
+         });
+        vec.clear();
+
+        stct::Vector< DropLogger, 8 > loggers(3, DropLogger{ destructed });
+        loggers.insert(loggers.begin() + 1, 2, loggers.back());
+        loggers.erase(loggers.begin());
+    }
+    auto allocations = scope.allocations();
+    REQUIRE(allocations == 0);
+    REQUIRE(destructed == 6);
+    REQUIRE(sum != 0);
+}
+
+TEST_CASE("vector fill insert keeps aliased value")
+{
+    stct::Vector< int, 16 > vec{ 1, 2, 3 };
+    vec.insert(vec.begin(), 2, vec[1]);
+    REQUIRE(vec == stct::Vector< int, 16 >{ 2, 2, 1, 2, 3 });
+}
+
+TEST_CASE("tuple is allocation free")
+{
+    size_t sum = 0;
+
+    stct::testing::AllocationScope scope;
+    {
+        auto tuple = stct::Tuple{ int{ 1 }, size_t{ 2 }, char{ 3 } };
+        auto copy = tuple;
+        auto made = stct::make_tuple(4, 5u);
+        int a = 0;
+        size_t b = 0;
+        char c = 0;
+        stct::tie(a, b, c) = copy;
+        stct::for_each(tuple.view_full(),
+         [](auto & elem)
+         {
+             elem *= 2;
+         });
+        stct::for_each(tuple.view< 1, 3 >(),
+         [](auto & elem)
+         {
+             elem += 1;
+         });
+        auto joined = stct::concat(tuple, made);
+        sum += stct::unwrap_then_do(
+         [](auto... elems)
+         {
+             return (size_t(elems) + ...);
+         },
+         joined);
+        sum += a + b + c + get< 0 >(made) + (tuple == copy);
+    }
+    auto allocations = scope.allocations();
+    REQUIRE(allocations == 0);
+    REQUIRE(sum != 0);
+}
+
+TEST_CASE("fwd is allocation free")
+{
+    using sizeof_less = stct::comparators::size_of::less;
+    size_t sum = 0;
+
+    stct::testing::AllocationScope scope;
+    {
+        auto sum_all = [](auto... args)
+        {
+            return (size_t(args) + ...);
+        };
+        sum += stct::fwd_ith< 1 >(sum_all, 1, 2, 3);
+        sum += stct::fwd_sliced< 1, 3 >(sum_all, 1, 2, 3);
+        sum += stct::fwd_first< 2 >(sum_all, 1, 2, 3);
+        sum += stct::fwd_last< 1 >(sum_all, 1, 2, 3);
+        sum += stct::fwd_swapped< 0, 2 >(sum_all, 1, 2, 3);
+        sum += stct::fwd_sorted< sizeof_less >(sum_all, long(1), char(2), short(3));
+    }
+    auto allocations = scope.allocations();
+    REQUIRE(allocations == 0);
+    REQUIRE(sum != 0);
+}
+
+TEST_CASE("variant is allocation free")
+{
+    size_t sum = 0;
+
+    stct::testing::AllocationScope scope;
+    {
+        stct::Variant< int, bool > var;
+        var = int{ 2 };
+        sum += var.at< 0 >() + var.at_t< int >() + var.holds< int >() + var.index();
+        sum += get< 0 >(var) + get< int >(var);
+        var = bool{ true };
+        sum += stct::visit(var,
+         [](auto & val)
+         {
+             return size_t(val);
+         });
+
+        stct::Variant< int, bool > copy = var;
+        sum += copy.index();
+    }
+    auto allocations = scope.allocations();
+    REQUIRE(allocations == 0);
+    REQUIRE(sum != 0);
+}
+
+TEST_CASE("map is allocation free")
+{
+    size_t to_set = 0;
+    size_t sum = 0;
+
+    stct::testing::AllocationScope scope;
+    {
+        auto set1 = [&to_set]()
+        {
+            to_set = 1;
+        };
+        auto set2 = std::bind(
+         [](size_t & to_set, size_t some)
+         {
+             to_set = some;
+         },
+         std::ref(to_set),
+         2);
+        auto handlers = stct::make_map< int >(stct::Tuple{ 1, set1 }, stct::Tuple{ 2, set2 });
+        auto counters = stct::make_map< int >(stct::Tuple{ 0, int(1) },
+         stct::Tuple{ 1, short(1) },
+         stct::Tuple{ 2, char(1) });
+
+        using namespace stct::visitors;
+        call_at(handlers, 2);
+        sum += to_set;
+        call_at(handlers, 1);
+        sum += to_set + handlers.idx(2);
+        incr_at(counters, 0);
+        decr_at(counters, 2);
+        sum += counters.at< 0 >() + counters.at< 1 >();
+        sum += counters.visit_at(1,
+         [](auto & elem)
+         {
+             return size_t(elem);
+         });
+    }
+    auto allocations = scope.allocations();
+    REQUIRE(allocations == 0);
+    REQUIRE(sum != 0);
+}
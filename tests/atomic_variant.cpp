@@ -0,0 +1,76 @@
+#include "atomic_variant.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace stct = static_containers;
+
+namespace
+{
+    struct Idle
+    {};
+
+    struct Running
+    {
+        std::uint32_t rate;
+        std::uint32_t limit;
+        double gain;
+    };
+}
+
+TEST_CASE("atomic variant stores and loads")
+{
+    stct::AtomicVariant< Idle, Running > state;
+    REQUIRE(state.load().holds< Idle >());
+
+    state.emplace< Running >(Running{ 10, 20, 0.5 });
+    auto loaded = state.load();
+    REQUIRE(loaded.at_t< Running >().limit == 20);
+
+    state.store(Idle{});
+    REQUIRE(state.try_load()->holds< Idle >());
+}
+
+TEST_CASE("atomic tuple stores and loads")
+{
+    stct::AtomicTuple< int, double, char > snapshot(stct::Tuple{ 1, 2.0, 'c' });
+    REQUIRE(snapshot.load() == stct::Tuple{ 1, 2.0, 'c' });
+    snapshot.emplace(4, 5.0, 'f');
+    REQUIRE(get< 1 >(snapshot.load()) == 5.0);
+}
+
+TEST_CASE("atomic tuple readers never see a torn value")
+{
+    using Snapshot = stct::Tuple< std::uint64_t, std::uint64_t, std::uint64_t, std::uint64_t >;
+    stct::AtomicTuple< std::uint64_t, std::uint64_t, std::uint64_t, std::uint64_t > snapshot(
+     Snapshot{ 0, 0, 0, 0 });
+    std::atomic< bool > done = false;
+    std::atomic< size_t > torn = 0;
+
+    auto read = [&]()
+    {
+        while (!done.load(std::memory_order_relaxed))
+        {
+            auto value = snapshot.load();
+            if (get< 0 >(value) != get< 1 >(value) || get< 0 >(value) != get< 3 >(value))
+            {
+                ++torn;
+            }
+        }
+    };
+    std::thread first(read);
+    std::thread second(read);
+    for (std::uint64_t i = 1; i <= 100000; ++i)
+    {
+        snapshot.store(Snapshot{ i, i, i, i });
+    }
+    done = true;
+    first.join();
+    second.join();
+    REQUIRE(torn == 0);
+    REQUIRE(get< 2 >(snapshot.load()) == 100000);
+}
@@ -0,0 +1,98 @@
+#include "compact_variant.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace stct = static_containers;
+
+namespace
+{
+    enum class Kind : std::uint8_t
+    {
+        Ping,
+        Pong,
+        Quit,
+    };
+}
+
+template <>
+struct stct::NicheTraits< Kind >
+{
+    static constexpr std::uint64_t SPARE_BITS = 0xfc;
+};
+
+TEST_CASE("compact variant of pointers is a pointer")
+{
+    using VarT = stct::CompactVariant< int *, double *, std::uint32_t * >;
+    static_assert(sizeof(VarT) == sizeof(void *));
+    static_assert(std::is_trivially_copyable_v< VarT >);
+
+    int i = 1;
+    double d = 2.0;
+    VarT var = &i;
+    REQUIRE(var.index() == 0);
+    REQUIRE(stct::get< int * >(var) == &i);
+
+    var = &d;
+    REQUIRE(var.holds< double * >());
+    REQUIRE(*stct::get< 1 >(var) == 2.0);
+    REQUIRE_THROWS_AS(var.at< 0 >(), std::bad_variant_access);
+
+    VarT copy = var;
+    REQUIRE(copy == var);
+    copy = static_cast< double * >(nullptr);
+    REQUIRE_FALSE(copy == var);
+}
+
+TEST_CASE("compact variant uses declared spare bits")
+{
+    using VarT = stct::CompactVariant< Kind, bool >;
+    static_assert(sizeof(VarT) == 1);
+
+    VarT var;
+    REQUIRE(var.at< 0 >() == Kind::Ping);
+    var = Kind::Quit;
+    REQUIRE(var.at_t< Kind >() == Kind::Quit);
+    var = true;
+    REQUIRE(var.at_t< bool >());
+    REQUIRE(var.emplace< Kind >(Kind::Pong) == Kind::Pong);
+    REQUIRE(var.index() == 0);
+}
+
+TEST_CASE("compact variant widens smaller alternatives")
+{
+    using VarT = stct::CompactVariant< std::uint64_t *, bool >;
+    static_assert(sizeof(VarT) == sizeof(void *));
+
+    std::uint64_t value = 0;
+    VarT var = true;
+    REQUIRE(var.at< 1 >());
+    var = &value;
+    REQUIRE(var.at< 0 >() == &value);
+    var = false;
+    REQUIRE_FALSE(var.at< 1 >());
+}
+
+TEST_CASE("visit compact variant")
+{
+    int i = 5;
+    stct::CompactVariant< int *, bool > var = &i;
+    auto visitor = [](auto val) -> int
+    {
+        if constexpr (std::is_same_v< decltype(val), int * >)
+        {
+            return *val;
+        }
+        else
+        {
+            return static_cast< int >(val);
+        }
+    };
+    REQUIRE(stct::visit(visitor, var) == 5);
+    var = true;
+    REQUIRE(stct::visit(visitor, var) == 1);
+}
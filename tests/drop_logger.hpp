@@ -8,6 +8,13 @@
 
 namespace static_containers::testing
 {
+    /// Copies and moves made of a DropLogger and of all its copies
+    struct CopyMoveLog
+    {
+        size_t copies = 0;
+        size_t moves = 0;
+    };
+
     class DropLogger
     {
        public:
@@ -15,24 +22,60 @@ namespace static_containers::testing
           cnt_(cnt)
         {}
 
-        DropLogger(const DropLogger &) = default;
+        DropLogger(size_t & cnt, CopyMoveLog & log):
+          cnt_(cnt),
+          log_(&log)
+        {}
+
+        DropLogger(const DropLogger & rhs):
+          cnt_(rhs.cnt_),
+          log_(rhs.log_),
+          moved_(rhs.moved_),
+          destroyed_(rhs.destroyed_)
+        {
+            if (log_ != nullptr)
+            {
+                ++log_->copies;
+            }
+        }
 
         DropLogger(DropLogger && rhs):
           cnt_(rhs.cnt_),
+          log_(rhs.log_),
           moved_(rhs.moved_),
           destroyed_(rhs.destroyed_)
         {
             rhs.moved_ = true;
+            if (log_ != nullptr)
+            {
+                ++log_->moves;
+            }
         }
 
-        DropLogger & operator=(const DropLogger &) = default;
+        DropLogger & operator=(const DropLogger & rhs)
+        {
+            cnt_ = rhs.cnt_;
+            log_ = rhs.log_;
+            moved_ = rhs.moved_;
+            destroyed_ = rhs.destroyed_;
+            if (log_ != nullptr)
+            {
+                ++log_->copies;
+            }
+            return *this;
+        }
 
         DropLogger & operator=(DropLogger && rhs)
         {
             cnt_ = rhs.cnt_;
+            log_ = rhs.log_;
             moved_ = rhs.moved_;
             destroyed_ = rhs.destroyed_;
             rhs.moved_ = true;
+            if (log_ != nullptr)
+            {
+                ++log_->moves;
+            }
             return *this;
         }
 
@@ -48,6 +91,7 @@ namespace static_containers::testing
 
        private:
         std::reference_wrapper< size_t > cnt_;
+        CopyMoveLog * log_ = nullptr;
         bool moved_ = false;
         bool destroyed_ = false;
     };
@@ -0,0 +1,108 @@
+#include "event_bus.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace stct = static_containers;
+
+namespace
+{
+    struct Tick
+    {
+        int frame;
+    };
+
+    struct Resize
+    {
+        int width;
+    };
+
+    struct Quit
+    {};
+
+    /// Accepts Tick and Resize, but not Quit
+    struct Renderer
+    {
+        void operator()(const Tick & tick)
+        {
+            frames.push_back(tick.frame);
+        }
+
+        void operator()(const Resize & resize)
+        {
+            width = resize.width;
+        }
+
+        std::vector< int > frames;
+        int width = 0;
+    };
+}
+
+TEST_CASE("event bus calls only the subscribers accepting an event")
+{
+    std::vector< std::string > log;
+    auto bus = stct::make_event_bus(Renderer{},
+     [&](const Tick &)
+     {
+         log.push_back("physics");
+     },
+     [&](const Quit &)
+     {
+         log.push_back("quit");
+     });
+
+    STATIC_REQUIRE(decltype(bus)::subscribers_of< Tick >() == 2);
+    STATIC_REQUIRE(decltype(bus)::subscribers_of< Resize >() == 1);
+    STATIC_REQUIRE(decltype(bus)::subscribers_of< int >() == 0);
+
+    bus.emit(Tick{ 1 });
+    bus.emit(Resize{ 640 });
+    bus.emit(Tick{ 2 });
+    bus.emit(Quit{});
+    bus.emit(42);
+
+    REQUIRE(bus.subscriber< 0 >().frames == std::vector{ 1, 2 });
+    REQUIRE(bus.subscriber< 0 >().width == 640);
+    REQUIRE(log == std::vector< std::string >{ "physics", "physics", "quit" });
+}
+
+TEST_CASE("event bus hands every event to generic subscribers")
+{
+    size_t seen = 0;
+    auto bus = stct::make_event_bus(
+     [&](const auto &)
+     {
+         ++seen;
+     });
+    bus.emit(Tick{ 0 });
+    bus.emit(Quit{});
+    REQUIRE(seen == 2);
+}
+
+TEST_CASE("event bus emits in parallel")
+{
+    std::atomic< size_t > calls = 0;
+    std::atomic< int > frames = 0;
+    auto count = [&](const Tick & tick)
+    {
+        ++calls;
+        frames += tick.frame;
+    };
+    auto bus = stct::make_event_bus(count,
+     count,
+     count,
+     [](const Quit &)
+     {
+         FAIL("Quit was not emitted");
+     });
+
+    bus.parallel_emit(Tick{ 3 });
+    bus.parallel_emit(Resize{ 1 });
+    REQUIRE(calls == 3);
+    REQUIRE(frames == 9);
+}
@@ -0,0 +1,189 @@
+#include "flat_map.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace stct = static_containers;
+
+TEST_CASE("flat map inserts, finds and erases in key order")
+{
+    stct::FlatMap< int, std::string, 8 > map;
+    REQUIRE(map.empty());
+    REQUIRE(map.find(1) == nullptr);
+    REQUIRE(map.try_emplace(3, "three").second);
+    REQUIRE(map.try_emplace(1, 3, 'o').second);
+    REQUIRE_FALSE(map.try_emplace(3, "tres").second);
+    map.insert_or_assign(3, "tres");
+    map[2] = "two";
+
+    REQUIRE(map.at(1) == "ooo");
+    REQUIRE(*map.find(3) == "tres");
+    REQUIRE_THROWS_AS(map.at(4), std::out_of_range);
+    REQUIRE(std::vector< int >(map.keys().begin(), map.keys().end()) ==
+            std::vector< int >{ 1, 2, 3 });
+
+    REQUIRE(map.erase(2));
+    REQUIRE_FALSE(map.erase(2));
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.values()[1] == "tres");
+}
+
+TEST_CASE("flat map refuses entries past its capacity")
+{
+    stct::FlatMap< int, int, 3 > map;
+    map[2] = 0;
+    map[0] = 0;
+    map[1] = 0;
+    REQUIRE_THROWS_AS(map[3], std::length_error);
+    REQUIRE(map.try_emplace(1, 5).first == map.find(1));
+
+    const std::vector< std::pair< int, int > > more{ { 4, 4 } };
+    REQUIRE_THROWS_AS(map.insert_range(more), std::length_error);
+    REQUIRE(map.size() == 3);
+}
+
+TEST_CASE("flat map lower bound matches std::lower_bound")
+{
+    stct::FlatSet< int, 64 > set;
+    for (int i = 0; i < 33; ++i)
+    {
+        size_t mismatches = 0;
+        for (int key = -1; key <= 2 * i + 1; ++key)
+        {
+            auto expected = std::lower_bound(set.begin(), set.end(), key) - set.begin();
+            mismatches += set.lower_bound(key) != static_cast< size_t >(expected);
+        }
+        REQUIRE(mismatches == 0);
+        set.insert(2 * i);
+    }
+}
+
+TEST_CASE("flat map insert range keeps existing and first keys")
+{
+    stct::FlatMap< int, std::string, 16 > map;
+    map[5] = "old five";
+    map[1] = "old one";
+    const std::vector< std::pair< int, std::string > > incoming{
+        { 7, "seven" },
+        { 5, "new five" },
+        { 3, "three" },
+        { 7, "second seven" },
+        { 0, "zero" },
+    };
+    map.insert_range(incoming.begin(), incoming.end());
+
+    std::vector< std::pair< int, std::string > > entries;
+    map.for_each([&](int key, const std::string & value) { entries.emplace_back(key, value); });
+    REQUIRE(entries == std::vector< std::pair< int, std::string > >{
+                        { 0, "zero" },
+                        { 1, "old one" },
+                        { 3, "three" },
+                        { 5, "old five" },
+                        { 7, "seven" },
+                       });
+}
+
+TEST_CASE("flat map insert range counts only the keys it adds")
+{
+    stct::FlatSet< int, 4 > set;
+    set.insert_range(std::vector{ 1, 1, 1, 1, 1 });
+    REQUIRE(set.size() == 1);
+    set.insert_range(std::vector{ 4, 3, 1, 4, 3, 2, 1, 2, 4 });
+    REQUIRE(std::vector< int >(set.begin(), set.end()) == std::vector< int >{ 1, 2, 3, 4 });
+    REQUIRE_THROWS_AS(set.insert_range(std::vector{ 2, 5, 2 }), std::length_error);
+    REQUIRE(set.size() == 4);
+
+    stct::FlatMap< int, std::string, 2 > map;
+    const std::vector< std::pair< int, std::string > > incoming{
+        { 2, "two" },
+        { 1, "one" },
+        { 2, "second two" },
+        { 1, "second one" },
+        { 2, "third two" },
+    };
+    map.insert_range(incoming);
+    REQUIRE(map.at(1) == "one");
+    REQUIRE(map.at(2) == "two");
+}
+
+TEST_CASE("flat map agrees with std::map under random edits")
+{
+    stct::FlatMap< int, int, 128 > map;
+    std::map< int, int > reference;
+    std::mt19937 rng(42);
+    size_t mismatches = 0;
+    for (int step = 0; step < 5000; ++step)
+    {
+        int key = static_cast< int >(rng() % 256);
+        switch (rng() % 4)
+        {
+        case 0:
+            if (reference.size() < map.capacity())
+            {
+                map.insert_or_assign(key, step);
+                reference[key] = step;
+            }
+            break;
+        case 1: {
+            std::vector< std::pair< int, int > > batch;
+            for (size_t i = rng() % 8; i > 0; --i)
+            {
+                batch.emplace_back(static_cast< int >(rng() % 256), step);
+            }
+            std::map< int, int > merged = reference;
+            merged.insert(batch.begin(), batch.end());
+            if (merged.size() <= map.capacity())
+            {
+                map.insert_range(batch);
+                reference = std::move(merged);
+            }
+            break;
+        }
+        default:
+            mismatches += map.erase(key) != (reference.erase(key) == 1);
+        }
+    }
+    REQUIRE(mismatches == 0);
+    REQUIRE(map.size() == reference.size());
+    REQUIRE(std::equal(map.keys().begin(), map.keys().end(), reference.begin(), reference.end(),
+     [](int key, const auto & entry) { return key == entry.first; }));
+    for (const auto & [key, value]: reference)
+    {
+        mismatches += map.at(key) != value;
+    }
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("flat set merges ranges and compares heterogeneously")
+{
+    stct::FlatSet< std::string, 8, std::less<> > set;
+    REQUIRE(set.insert("pear"));
+    REQUIRE_FALSE(set.insert("pear"));
+    const std::string_view fruit[] = { "fig", "apple", "pear", "fig" };
+    set.insert_range(fruit);
+    REQUIRE(std::vector< std::string >(set.begin(), set.end()) ==
+            std::vector< std::string >{ "apple", "fig", "pear" });
+    REQUIRE(set.contains(std::string_view("fig")));
+    REQUIRE(set.erase("apple"));
+    REQUIRE_FALSE(set.contains("apple"));
+}
+
+TEST_CASE("flat set orders by its comparator")
+{
+    stct::FlatSet< int, 8, std::greater< int > > set;
+    const std::set< int > incoming{ 1, 4, 2 };
+    set.insert(3);
+    set.insert_range(incoming);
+    REQUIRE(std::vector< int >(set.begin(), set.end()) == std::vector< int >{ 4, 3, 2, 1 });
+}
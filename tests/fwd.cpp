@@ -7,6 +7,8 @@
 #include <cstddef>
 #include <utility>
 
+#include "drop_logger.hpp"
+
 namespace stct = static_containers;
 
 namespace
@@ -100,3 +102,36 @@ TEST_CASE("fwd sorted")
 
     REQUIRE(decltype(res)::args_as_pack::is_sorted< sizeof_less >());
 }
+
+TEST_CASE("fwd permuted")
+{
+    auto res = stct::fwd_permuted< 2, 0, 2 >(stct::make_tuple, int(0), long(1), char(2));
+    REQUIRE(res == stct::Tuple{ char(2), int(0), char(2) });
+}
+
+TEST_CASE("fwd reversed")
+{
+    auto res = stct::fwd_reversed(stct::make_tuple, int(0), long(1), char(2));
+    REQUIRE(res == stct::Tuple{ char(2), long(1), int(0) });
+}
+
+TEST_CASE("fwd passes arguments without copies")
+{
+    using stct::testing::CopyMoveLog;
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    CopyMoveLog log;
+    DropLogger first{ destructed, log };
+    DropLogger second{ destructed, log };
+    auto check = [&](DropLogger & lhs, DropLogger && rhs)
+    {
+        return &lhs == &second && &rhs == &first;
+    };
+
+    REQUIRE(stct::fwd_swapped< 0, 1 >(check, std::move(first), second));
+    REQUIRE(stct::fwd_reversed(check, std::move(first), second));
+    REQUIRE(stct::fwd_permuted< 1, 0 >(check, std::move(first), second));
+    REQUIRE(stct::fwd_sliced< 1, 3 >(check, 0, second, std::move(first)));
+    REQUIRE(log.copies == 0);
+    REQUIRE(log.moves == 0);
+}
@@ -0,0 +1,112 @@
+#include "indirect.hpp"
+#include "variant.hpp"
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace stct = static_containers;
+
+namespace
+{
+    struct ErrorContext
+    {
+        int code;
+        std::array< char, 1024 > text{};
+    };
+
+    using Message = stct::Variant< int, stct::Indirect< ErrorContext, 2 > >;
+    using Pool = stct::Indirect< ErrorContext, 2 >::Pool;
+}
+
+TEST_CASE("indirect alternative keeps variant small")
+{
+    static_assert(sizeof(Message) == 2 * sizeof(void *));
+
+    Message message = ErrorContext{ 42 };
+    REQUIRE(message.holds< ErrorContext >());
+    REQUIRE(stct::get< ErrorContext >(message).code == 42);
+    REQUIRE(message.at< 1 >().code == 42);
+
+    message = ErrorContext{ 7 };
+    REQUIRE(message.at_t< ErrorContext >().code == 7);
+
+    auto code = stct::visit(
+     [](auto & value)
+     {
+         if constexpr (std::is_same_v< decltype(value), ErrorContext & >)
+         {
+             return value.code;
+         }
+         else
+         {
+             return value;
+         }
+     },
+     message);
+    REQUIRE(code == 7);
+}
+
+TEST_CASE("indirect alternatives come from the pool")
+{
+    auto & pool = stct::Indirect< ErrorContext, 2 >::pool();
+    REQUIRE(Pool::capacity() == 2);
+    size_t before = pool.in_use();
+    {
+        Message first = ErrorContext{ 1 };
+        Message second = first;
+        REQUIRE(pool.in_use() == before + 2);
+        REQUIRE(stct::get< ErrorContext >(second).code == 1);
+
+        REQUIRE_THROWS_AS(Message(ErrorContext{ 3 }), std::bad_alloc);
+
+        Message moved = std::move(first);
+        REQUIRE(pool.in_use() == before + 2);
+
+        second = 5;
+        REQUIRE(pool.in_use() == before + 1);
+        REQUIRE(stct::get< ErrorContext >(moved).code == 1);
+    }
+    REQUIRE(pool.in_use() == before);
+    REQUIRE(pool.high_water_mark() == 2);
+}
+
+TEST_CASE("moved-from indirect alternative holds no value")
+{
+    auto & pool = stct::Indirect< ErrorContext, 2 >::pool();
+    size_t before = pool.in_use();
+    {
+        Message first = ErrorContext{ 1 };
+        Message moved = std::move(first);
+        REQUIRE(first.holds< ErrorContext >());
+        REQUIRE_THROWS_AS(first.at< 1 >(), std::bad_variant_access);
+
+        Message copy = first;
+        REQUIRE(pool.in_use() == before + 1);
+        REQUIRE_THROWS_AS(stct::visit([](const auto &) {}, copy), std::bad_variant_access);
+
+        copy = moved;
+        REQUIRE(pool.in_use() == before + 2);
+        REQUIRE(copy.at< 1 >().code == 1);
+
+        moved = first;
+        REQUIRE(pool.in_use() == before + 1);
+        REQUIRE_THROWS_AS(stct::get< ErrorContext >(moved), std::bad_variant_access);
+
+        moved = ErrorContext{ 2 };
+        REQUIRE(pool.in_use() == before + 2);
+        REQUIRE(moved.at< 1 >().code == 2);
+    }
+    REQUIRE(pool.in_use() == before);
+
+    stct::Indirect< ErrorContext, 2 > indirect(ErrorContext{ 2 });
+    auto taken = std::move(indirect);
+    REQUIRE(indirect.valueless_after_move());
+    REQUIRE_FALSE(taken.valueless_after_move());
+    REQUIRE(taken.get().code == 2);
+}
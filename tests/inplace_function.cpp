@@ -0,0 +1,151 @@
+#include "inplace_function.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "drop_logger.hpp"
+#include "vector.hpp"
+
+namespace stct = static_containers;
+
+namespace
+{
+    int twice(int value)
+    {
+        return value * 2;
+    }
+
+    /// InplaceFunction only takes callables which move without throwing
+    struct NothrowDropLogger : stct::testing::DropLogger
+    {
+        using DropLogger::DropLogger;
+
+        NothrowDropLogger(NothrowDropLogger && rhs) noexcept:
+          DropLogger(std::move(rhs))
+        {}
+    };
+}
+
+TEST_CASE("inplace function calls what it holds")
+{
+    stct::InplaceFunction< int(int) > f;
+    REQUIRE_FALSE(f);
+    REQUIRE(f == nullptr);
+    REQUIRE_THROWS_AS(f(1), std::bad_function_call);
+
+    f = &twice;
+    REQUIRE(f);
+    REQUIRE(f(4) == 8);
+
+    int offset = 10;
+    f = [&offset](int value)
+    {
+        return value + offset;
+    };
+    offset = 20;
+    REQUIRE(f(1) == 21);
+
+    f = nullptr;
+    REQUIRE_FALSE(f);
+
+    int (*none)(int) = nullptr;
+    f = none;
+    REQUIRE_FALSE(f);
+}
+
+TEST_CASE("inplace function returning nothing drops the result of its callable")
+{
+    int calls = 0;
+    stct::InplaceFunction< void() > f = [&calls]()
+    {
+        return ++calls;
+    };
+    f();
+    REQUIRE(calls == 1);
+
+    stct::InplaceFunction< void(int) > g = &twice;
+    g(1);
+    REQUIRE(g);
+}
+
+TEST_CASE("inplace function holds move-only callables")
+{
+    auto owned = std::make_unique< int >(5);
+    stct::InplaceFunction< int() > f = [owned = std::move(owned)]()
+    {
+        return *owned;
+    };
+    stct::InplaceFunction< int() > g = std::move(f);
+    REQUIRE_FALSE(f);
+    REQUIRE(g() == 5);
+
+    swap(f, g);
+    REQUIRE(f() == 5);
+    REQUIRE_FALSE(g);
+}
+
+TEST_CASE("inplace function destroys its callable once")
+{
+    size_t drops = 0;
+    {
+        stct::InplaceFunction< void() > f = [logger = NothrowDropLogger(drops)]() {};
+        stct::InplaceFunction< void() > g = std::move(f);
+        stct::InplaceFunction< void() > h;
+        h = std::move(g);
+        REQUIRE(drops == 0);
+    }
+    REQUIRE(drops == 1);
+
+    stct::InplaceFunction< void() > f = [logger = NothrowDropLogger(drops)]() {};
+    f = []() {};
+    REQUIRE(drops == 2);
+}
+
+TEST_CASE("inplace function capacity is set at compile time")
+{
+    std::array< char, 40 > big{};
+    auto fits = [big]()
+    {
+        return big[0];
+    };
+    stct::InplaceFunction< char(), sizeof(fits) > f = fits;
+    REQUIRE(f() == 0);
+    STATIC_REQUIRE(!std::is_copy_constructible_v< stct::InplaceFunction< void() > >);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v< stct::InplaceFunction< void() > >);
+}
+
+TEST_CASE("inplace functions make a static handler table")
+{
+    std::string log;
+    stct::Vector< stct::InplaceFunction< void() >, 4 > handlers;
+    handlers.push_back(
+     [&log]()
+     {
+         log += 'a';
+     });
+    handlers.emplace_back(
+     [&log]()
+     {
+         log += 'b';
+     });
+    for (auto & handler: handlers)
+    {
+        handler();
+    }
+    handlers[0] = [&log]()
+    {
+        log += 'c';
+    };
+    handlers.pop_back();
+    for (auto & handler: handlers)
+    {
+        handler();
+    }
+    REQUIRE(log == "abc");
+}
@@ -78,3 +78,25 @@ TEST_CASE("map incr decr")
          }));
     }
 }
+
+TEST_CASE("map stateless handlers take no space")
+{
+    static size_t to_set = 0;
+    auto map = stct::make_map< int >(stct::Tuple{ 1,
+                                         []()
+                                         {
+                                             to_set = 1;
+                                         } },
+     stct::Tuple{ 2,
+      []()
+      {
+          to_set = 2;
+      } });
+    static_assert(sizeof(map) == sizeof(std::array< int, 2 >));
+
+    using namespace stct::visitors;
+    call_at(map, 2);
+    REQUIRE(to_set == 2);
+    call_at(map, 1);
+    REQUIRE(to_set == 1);
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#include "packed_tuple.hpp"
+#include "vector.hpp"
+
+namespace stct = static_containers;
+
+namespace
+{
+    /// Not a POD, so a following member may be placed in its tail padding
+    struct NonPod
+    {
+        NonPod(int a = 0):
+          a(a)
+        {}
+
+        int a;
+        char b = 0;
+    };
+}
+
+TEST_CASE("packed tuple size")
+{
+    using Record = stct::Tuple< char, double, short, int, char >;
+    using PackedRecord = stct::PackedTuple< char, double, short, int, char >;
+    static_assert(sizeof(Record) == 32);
+    static_assert(sizeof(PackedRecord) == 16);
+    static_assert(sizeof(stct::Vector< PackedRecord, 64 >) < sizeof(stct::Vector< Record, 64 >));
+
+    REQUIRE(PackedRecord::physical_index(1) == 0);
+    REQUIRE(PackedRecord::physical_index(3) == 1);
+    REQUIRE(PackedRecord::physical_index(2) == 2);
+    REQUIRE(PackedRecord::physical_index(0) == 3);
+    REQUIRE(PackedRecord::physical_index(4) == 4);
+};
+
+TEST_CASE("packed tuple fills the tail padding of a non-POD member")
+{
+    using Packed = stct::PackedTuple< NonPod, char >;
+    static_assert(sizeof(Packed) <= 2 * sizeof(NonPod));
+
+    Packed packed{ NonPod(7), 'x' };
+    REQUIRE(packed.at< 0 >().a == 7);
+    REQUIRE(packed.at< 1 >() == 'x');
+    packed.at< 0 >().b = 'y';
+    REQUIRE(packed.at< 1 >() == 'x');
+}
+
+TEST_CASE("packed tuple access")
+{
+    auto tuple = stct::PackedTuple{ char{ 0 }, double{ 1 }, short{ 2 }, int{ 3 } };
+    REQUIRE(tuple.at< 0 >() == 0);
+    REQUIRE(tuple.at< 1 >() == 1);
+    REQUIRE(get< 2 >(tuple) == 2);
+    REQUIRE(get< 3 >(tuple) == 3);
+    get< 0 >(tuple) = 4;
+    REQUIRE(tuple.at< 0 >() == 4);
+};
+
+TEST_CASE("packed tuple tie")
+{
+    auto tuple = stct::make_packed_tuple(char{ 0 }, std::uint64_t{ 1 }, short{ 2 });
+    char a = 1;
+    std::uint64_t b = 2;
+    short c = 3;
+    stct::tie(a, b, c) = tuple;
+    REQUIRE(a == 0);
+    REQUIRE(b == 1);
+    REQUIRE(c == 2);
+};
+
+TEST_CASE("packed tuple comparison")
+{
+    auto lhs = stct::PackedTuple{ char{ 0 }, double{ 2 }, int{ 0 } };
+    auto rhs = stct::PackedTuple{ char{ 1 }, double{ 1 }, int{ 0 } };
+    REQUIRE(lhs == lhs);
+    REQUIRE(lhs != rhs);
+    REQUIRE(lhs < rhs);
+};
+
+TEST_CASE("packed tuple view and concat")
+{
+    auto tuple = stct::PackedTuple{ char{ 1 }, double{ 1 }, short{ 1 }, int{ 1 } };
+    stct::for_each(tuple.view< 1, 3 >(),
+     [](auto & elem)
+     {
+         elem *= 2;
+     });
+    REQUIRE(tuple == stct::PackedTuple{ char{ 1 }, double{ 2 }, short{ 2 }, int{ 1 } });
+
+    auto result = stct::concat(tuple, stct::Tuple{ char{ 3 } });
+    REQUIRE(result == stct::Tuple{ char{ 1 }, double{ 2 }, short{ 2 }, int{ 1 }, char{ 3 } });
+};
@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "parallel.hpp"
+
+namespace stct = static_containers;
+
+namespace
+{
+    /// Stands for a subsystem with some state of its own
+    template < size_t I >
+    struct Subsystem
+    {
+        size_t run() const
+        {
+            return I + payload[0];
+        }
+
+        std::array< size_t, 16 > payload{};
+    };
+}
+
+TEST_CASE("thread pool runs submitted tasks")
+{
+    stct::ThreadPool pool(2);
+    std::atomic< size_t > done = 0;
+    std::array< stct::TaskGroup::Job, 100 > jobs;
+    stct::TaskGroup group(pool);
+    for (auto & job: jobs)
+    {
+        job = { [](void * ctx)
+            {
+                ++*static_cast< std::atomic< size_t > * >(ctx);
+            },
+            &done };
+        group.run(job);
+    }
+    group.wait();
+    REQUIRE(pool.workers() == 2);
+    REQUIRE(done == jobs.size());
+}
+
+TEST_CASE("parallel for each")
+{
+    auto tuple = stct::Tuple{ Subsystem< 0 >{}, Subsystem< 1 >{}, Subsystem< 2 >{} };
+    stct::parallel_for_each(tuple.view_full(),
+     [](auto & subsystem)
+     {
+         subsystem.payload[0] = subsystem.run() + 1;
+     });
+    REQUIRE(tuple.at< 0 >().payload[0] == 1);
+    REQUIRE(tuple.at< 1 >().payload[0] == 2);
+    REQUIRE(tuple.at< 2 >().payload[0] == 3);
+}
+
+TEST_CASE("parallel transform")
+{
+    auto tuple = stct::Tuple{ Subsystem< 0 >{}, int{ 2 }, Subsystem< 5 >{}, std::string("abc") };
+    auto results = stct::parallel_transform(tuple.view< 1, 4 >(),
+     []< typename T >(const T & elem)
+     {
+         if constexpr (std::is_same_v< T, int >)
+         {
+             return elem * 2;
+         }
+         else if constexpr (std::is_same_v< T, std::string >)
+         {
+             return elem + elem;
+         }
+         else
+         {
+             return elem.run();
+         }
+     });
+    REQUIRE(results == stct::Tuple{ int{ 4 }, size_t{ 5 }, std::string("abcabc") });
+}
+
+TEST_CASE("parallel elements below an explicit cutoff stay on caller")
+{
+    const auto caller = std::this_thread::get_id();
+    auto tuple = stct::Tuple{ int{ 0 }, char{ 0 }, Subsystem< 0 >{} };
+    auto ran_here = stct::parallel_transform< sizeof(Subsystem< 0 >) >(tuple.view< 0, 2 >(),
+     [&](auto &)
+     {
+         return std::this_thread::get_id() == caller;
+     });
+    REQUIRE(ran_here == stct::Tuple{ true, true });
+}
+
+TEST_CASE("parallel exception propagates")
+{
+    auto tuple = stct::Tuple{ Subsystem< 0 >{}, Subsystem< 1 >{}, Subsystem< 2 >{} };
+    std::atomic< size_t > visited = 0;
+    auto throwing = [&](auto & subsystem)
+    {
+        ++visited;
+        if (subsystem.run() == 1)
+        {
+            throw std::runtime_error("subsystem failed");
+        }
+    };
+    REQUIRE_THROWS_AS(stct::parallel_for_each(tuple.view_full(), throwing), std::runtime_error);
+    REQUIRE(visited == 3);
+}
+
+TEST_CASE("parallel nested")
+{
+    auto inner = [](auto & subsystem)
+    {
+        auto parts = stct::Tuple{ Subsystem< 0 >{}, Subsystem< 1 >{} };
+        auto sums = stct::parallel_transform(parts.view_full(),
+         [](const auto & part)
+         {
+             return part.run();
+         });
+        subsystem.payload[0] = get< 0 >(sums) + get< 1 >(sums);
+    };
+    auto tuple = stct::Tuple{ Subsystem< 0 >{}, Subsystem< 1 >{}, Subsystem< 2 >{},
+        Subsystem< 3 >{} };
+    stct::parallel_for_each(tuple.view_full(), inner);
+    REQUIRE(tuple.at< 3 >().payload[0] == 1);
+}
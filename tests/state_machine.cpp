@@ -0,0 +1,185 @@
+#include "state_machine.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "drop_logger.hpp"
+
+namespace stct = static_containers;
+
+namespace
+{
+    struct Closed
+    {};
+
+    struct Connecting
+    {
+        int attempts = 0;
+    };
+
+    struct Established
+    {
+        std::string peer;
+        size_t sent = 0;
+    };
+
+    struct Connect
+    {
+        std::string peer;
+    };
+
+    struct Retry
+    {};
+
+    struct Accepted
+    {};
+
+    struct Send
+    {
+        size_t bytes;
+    };
+
+    struct Close
+    {};
+
+    auto make_connection()
+    {
+        return stct::make_state_machine< Closed, Connecting, Established >(
+         stct::on< Closed, Connect >(
+          [](Closed &, const Connect &)
+          {
+              return Connecting{ 1 };
+          }),
+         stct::on< Connecting, Retry >(
+          [](Connecting & state, const Retry &)
+          {
+              ++state.attempts;
+          }),
+         stct::on< Connecting, Accepted >(
+          [](Connecting &, const Accepted &)
+          {
+              return Established{ "peer", 0 };
+          }),
+         stct::on< Established, Send >(
+          [](Established & state, const Send & send)
+          {
+              state.sent += send.bytes;
+          }),
+         stct::on< Established, Close >(
+          [](Established &, const Close &)
+          {
+              return Closed{};
+          }));
+    }
+
+    template < typename State, typename Event >
+    using Handler = stct::Transition< State, Event, void (*)(State &, const Event &) >;
+
+    /// Whether a connection machine can be made of these transitions
+    template < typename... Transitions >
+    concept ConnectionTransitions = requires(Transitions... transitions) {
+        stct::make_state_machine< Closed, Connecting, Established >(transitions...);
+    };
+}
+
+TEST_CASE("state machine follows transitions")
+{
+    auto connection = make_connection();
+    REQUIRE(connection.is< Closed >());
+
+    REQUIRE(connection.dispatch(Connect{ "peer" }));
+    REQUIRE(connection.is< Connecting >());
+
+    REQUIRE(connection.dispatch(Retry{}));
+    REQUIRE(connection.dispatch(Retry{}));
+    REQUIRE(get< Connecting >(connection.state()).attempts == 3);
+
+    REQUIRE(connection.dispatch(Accepted{}));
+    REQUIRE(connection.dispatch(Send{ 10 }));
+    REQUIRE(connection.dispatch(Send{ 5 }));
+    REQUIRE(get< Established >(connection.state()).sent == 15);
+
+    REQUIRE(connection.dispatch(Close{}));
+    REQUIRE(connection.is< Closed >());
+}
+
+TEST_CASE("state machine ignores events without a transition")
+{
+    auto connection = make_connection();
+    REQUIRE_FALSE(connection.dispatch(Send{ 1 }));
+    REQUIRE_FALSE(connection.dispatch(Accepted{}));
+    REQUIRE(connection.is< Closed >());
+}
+
+TEST_CASE("state machine dispatches variant events")
+{
+    using Event = stct::Variant< Connect, Retry, Accepted, Send, Close >;
+    auto connection = make_connection();
+
+    Event events[] = { Connect{ "peer" }, Send{ 3 }, Accepted{}, Send{ 4 }, Close{} };
+    size_t handled = 0;
+    for (const auto & event: events)
+    {
+        handled += connection.dispatch(event);
+    }
+    REQUIRE(handled == 4);
+    REQUIRE(connection.is< Closed >());
+}
+
+TEST_CASE("state machine destroys the state it leaves")
+{
+    using stct::testing::DropLogger;
+
+    struct Idle
+    {
+        DropLogger logger;
+    };
+
+    struct Busy
+    {
+        DropLogger logger;
+    };
+
+    struct Start
+    {};
+
+    struct Stop
+    {};
+
+    size_t drops = 0;
+    {
+        auto machine = stct::make_state_machine< Idle, Busy >(Idle{ DropLogger(drops) },
+         stct::on< Idle, Start >(
+          [&](Idle &, const Start &)
+          {
+              return Busy{ DropLogger(drops) };
+          }),
+         stct::on< Busy, Stop >(
+          [&](Busy &, const Stop &)
+          {
+              return Idle{ DropLogger(drops) };
+          }));
+        REQUIRE(machine.is< Idle >());
+        machine.dispatch(Start{});
+        REQUIRE(drops == 1);
+        machine.dispatch(Stop{});
+        REQUIRE(drops == 2);
+    }
+    REQUIRE(drops == 3);
+}
+
+TEST_CASE("state machine rejects stray and duplicate transitions")
+{
+    struct Stray
+    {};
+
+    static_assert(
+     ConnectionTransitions< Handler< Closed, Connect >, Handler< Connecting, Connect > >);
+    static_assert(!ConnectionTransitions< Handler< Stray, Connect > >);
+    static_assert(!ConnectionTransitions< Handler< Closed, Connect >, Handler< Closed, Connect > >);
+    static_assert(!ConnectionTransitions< Handler< Established, Send >,
+                  Handler< Closed, Connect >,
+                  Handler< Established, Send > >);
+}
@@ -0,0 +1,249 @@
+#include "static_hash_map.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "drop_logger.hpp"
+
+namespace stct = static_containers;
+
+namespace
+{
+    struct StringHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view str) const noexcept
+        {
+            return std::hash< std::string_view >{}(str);
+        }
+    };
+
+    /// Sends every key to the same home slot, so that all of them share one probe sequence
+    struct CollidingHash
+    {
+        size_t operator()(int) const noexcept
+        {
+            return 0;
+        }
+    };
+
+    /// Hash of its own seed, so that a map keeps finding its keys only with the same seed
+    struct SeededHash
+    {
+        size_t seed = 0;
+
+        size_t operator()(int key) const noexcept
+        {
+            return std::hash< int >{}(key) ^ seed;
+        }
+    };
+
+    /// Counts the objects alive, and throws when copied once copies has run out
+    struct CopyBudget
+    {
+        CopyBudget(size_t & alive, int & copies):
+          alive(&alive),
+          copies(&copies)
+        {
+            ++alive;
+        }
+
+        CopyBudget(const CopyBudget & rhs):
+          alive(rhs.alive),
+          copies(rhs.copies)
+        {
+            if ((*copies)-- == 0)
+            {
+                throw std::runtime_error("copy failed");
+            }
+            ++*alive;
+        }
+
+        CopyBudget & operator=(const CopyBudget &) = delete;
+
+        ~CopyBudget()
+        {
+            --*alive;
+        }
+
+        size_t * alive;
+        int * copies;
+    };
+}
+
+TEST_CASE("static hash map inserts, finds and erases")
+{
+    stct::StaticHashMap< int, std::string, 8 > map;
+    REQUIRE(map.empty());
+    REQUIRE(map.try_emplace(1, "one").second);
+    REQUIRE(map.try_emplace(2, 3, 't').second);
+    REQUIRE_FALSE(map.try_emplace(1, "uno").second);
+    REQUIRE(map.at(1) == "one");
+    REQUIRE(*map.find(2) == "ttt");
+    REQUIRE(map.find(3) == nullptr);
+
+    map.insert_or_assign(1, "uno");
+    map[4] = "four";
+    REQUIRE(map.at(1) == "uno");
+    REQUIRE(map.size() == 3);
+
+    REQUIRE(map.erase(2));
+    REQUIRE_FALSE(map.erase(2));
+    REQUIRE_FALSE(map.contains(2));
+    REQUIRE(map.size() == 2);
+    REQUIRE_THROWS_AS(map.at(2), std::out_of_range);
+}
+
+TEST_CASE("static hash map refuses entries past its capacity")
+{
+    stct::StaticHashMap< int, int, 4 > map;
+    for (int i = 0; i < 4; ++i)
+    {
+        map[i] = i;
+    }
+    REQUIRE_THROWS_AS(map[4], std::length_error);
+    REQUIRE(map.try_emplace(3, 0).first == map.find(3));
+    STATIC_REQUIRE(decltype(map)::slot_count() * 7 / 8 >= decltype(map)::capacity());
+}
+
+TEST_CASE("static hash map shifts back colliding entries on erase")
+{
+    stct::StaticHashMap< int, int, 32, CollidingHash > map;
+    for (int i = 0; i < 20; ++i)
+    {
+        map[i] = i * 10;
+    }
+    for (int i = 0; i < 20; i += 3)
+    {
+        REQUIRE(map.erase(i));
+    }
+    for (int i = 0; i < 20; ++i)
+    {
+        REQUIRE(map.contains(i) == (i % 3 != 0));
+    }
+    map[0] = 1;
+    REQUIRE(map.at(0) == 1);
+    REQUIRE(map.at(19) == 190);
+}
+
+TEST_CASE("static hash map agrees with std::map under random edits")
+{
+    stct::StaticHashMap< int, int, 112 > map;
+    std::map< int, int > reference;
+    std::mt19937 rng(42);
+    size_t mismatches = 0;
+    for (int step = 0; step < 20000; ++step)
+    {
+        int key = static_cast< int >(rng() % 256);
+        if (rng() % 2 == 0 && reference.size() < map.capacity())
+        {
+            map.insert_or_assign(key, step);
+            reference[key] = step;
+        }
+        else
+        {
+            mismatches += map.erase(key) != (reference.erase(key) == 1);
+        }
+    }
+    REQUIRE(mismatches == 0);
+    REQUIRE(map.size() == reference.size());
+    size_t seen = 0;
+    map.for_each(
+     [&](int key, int value)
+     {
+         mismatches += reference.at(key) != value;
+         ++seen;
+     });
+    REQUIRE(seen == reference.size());
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("static hash map looks up heterogeneously")
+{
+    stct::StaticHashMap< std::string, int, 16, StringHash, std::equal_to<> > map;
+    map.try_emplace("alpha", 1);
+    map.try_emplace(std::string("beta"), 2);
+    REQUIRE(map.at(std::string_view("alpha")) == 1);
+    REQUIRE(*map.find("beta") == 2);
+    REQUIRE(map.erase(std::string_view("beta")));
+    REQUIRE_FALSE(map.contains("beta"));
+}
+
+TEST_CASE("static hash map looks up keys converted to K")
+{
+    stct::StaticHashMap< long, int, 8 > numbers;
+    numbers.try_emplace(1, 1);
+    REQUIRE(numbers.contains(1));
+    REQUIRE(numbers.at(1) == 1);
+    REQUIRE(numbers.erase(1));
+
+    stct::StaticHashMap< std::string, int, 8 > words;
+    words.try_emplace("a", 1);
+    REQUIRE(words.contains("a"));
+    REQUIRE(*words.find("a") == 1);
+    REQUIRE(words.at("a") == 1);
+    REQUIRE(words.erase("a"));
+}
+
+TEST_CASE("static hash map copies, moves and destroys its entries")
+{
+    using stct::testing::DropLogger;
+
+    size_t drops = 0;
+    {
+        stct::StaticHashMap< int, DropLogger, 8 > map;
+        map.try_emplace(1, drops);
+        map.try_emplace(2, drops);
+        auto copy = map;
+        auto moved = std::move(copy);
+        REQUIRE(moved.size() == 2);
+        REQUIRE(copy.empty());
+        REQUIRE(drops == 0);
+        map.erase(1);
+        REQUIRE(drops == 1);
+    }
+    REQUIRE(drops == 4);
+}
+
+TEST_CASE("static hash map copies keep the hash of their source")
+{
+    stct::StaticHashMap< int, int, 32, SeededHash > map(SeededHash{ 0x5bd1e995 });
+    for (int i = 0; i < 32; ++i)
+    {
+        map.try_emplace(i, i);
+    }
+    auto copy = map;
+    auto moved = std::move(copy);
+    size_t missing = 0;
+    for (int i = 0; i < 32; ++i)
+    {
+        missing += moved.find(i) == nullptr;
+    }
+    REQUIRE(missing == 0);
+}
+
+TEST_CASE("static hash map destroys what it copied if a copy throws")
+{
+    size_t alive = 0;
+    int copies = 2;
+    {
+        stct::StaticHashMap< int, CopyBudget, 8 > map;
+        for (int i = 0; i < 4; ++i)
+        {
+            map.try_emplace(i, alive, copies);
+        }
+        REQUIRE(alive == 4);
+        using Map = decltype(map);
+        REQUIRE_THROWS_AS(Map(map), std::runtime_error);
+        REQUIRE(alive == 4);
+    }
+    REQUIRE(alive == 0);
+}
@@ -0,0 +1,168 @@
+#include "static_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+#include <new>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "drop_logger.hpp"
+
+namespace stct = static_containers;
+
+namespace
+{
+    struct Throwing
+    {
+        Throwing()
+        {
+            throw 1;
+        }
+    };
+}
+
+TEST_CASE("static pool creates and destroys objects")
+{
+    stct::StaticPool< std::string, 4 > pool;
+    std::string * first = pool.create("first");
+    std::string * second = pool.create(3, 's');
+    REQUIRE(*first == "first");
+    REQUIRE(*second == "sss");
+    REQUIRE(pool.in_use() == 2);
+    REQUIRE(pool.owns(first));
+
+    std::string outside;
+    REQUIRE_FALSE(pool.owns(&outside));
+
+    pool.destroy(first);
+    REQUIRE(pool.in_use() == 1);
+    REQUIRE(pool.create("reused") == first);
+}
+
+TEST_CASE("static pool runs out after N objects")
+{
+    stct::StaticPool< int, 3 > pool;
+    std::set< int * > taken;
+    for (int i = 0; i < 3; ++i)
+    {
+        taken.insert(pool.create(i));
+    }
+    REQUIRE(taken.size() == 3);
+    REQUIRE(pool.try_allocate() == nullptr);
+    REQUIRE_THROWS_AS(pool.create(3), std::bad_alloc);
+
+    pool.destroy(*taken.begin());
+    REQUIRE(pool.try_allocate() == *taken.begin());
+}
+
+TEST_CASE("static pool gives the slot back when construction throws")
+{
+    stct::StaticPool< Throwing, 1 > pool;
+    REQUIRE_THROWS_AS(pool.create(), int);
+    REQUIRE(pool.in_use() == 0);
+    REQUIRE(pool.try_allocate() != nullptr);
+}
+
+TEST_CASE("static pool destroys each object once")
+{
+    using stct::testing::DropLogger;
+
+    size_t drops = 0;
+    stct::StaticPool< DropLogger, 8 > pool;
+    std::vector< DropLogger * > loggers;
+    for (int i = 0; i < 8; ++i)
+    {
+        loggers.push_back(pool.create(drops));
+    }
+    for (DropLogger * logger: loggers)
+    {
+        pool.destroy(logger);
+    }
+    REQUIRE(drops == 8);
+    REQUIRE(pool.in_use() == 0);
+}
+
+TEST_CASE("atomic static pool hands each slot to one thread at a time")
+{
+    constexpr size_t THREADS = 4;
+    constexpr size_t PER_THREAD = 16;
+    stct::AtomicStaticPool< size_t, THREADS * PER_THREAD > pool;
+    std::vector< size_t > clashes(THREADS);
+    {
+        std::vector< std::jthread > threads;
+        for (size_t t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back(
+             [&, t]
+             {
+                 std::vector< size_t * > mine;
+                 for (int round = 0; round < 2000; ++round)
+                 {
+                     for (size_t i = 0; i < PER_THREAD; ++i)
+                     {
+                         mine.push_back(pool.create(t));
+                     }
+                     for (size_t * value: mine)
+                     {
+                         clashes[t] += *value != t;
+                         pool.destroy(value);
+                     }
+                     mine.clear();
+                 }
+             });
+        }
+    }
+    REQUIRE(std::count(clashes.begin(), clashes.end(), 0) == THREADS);
+
+    std::set< size_t * > taken;
+    for (size_t i = 0; i < THREADS * PER_THREAD; ++i)
+    {
+        taken.insert(pool.create(i));
+    }
+    REQUIRE(taken.size() == THREADS * PER_THREAD);
+    REQUIRE(pool.try_allocate() == nullptr);
+}
+
+TEST_CASE("static pool allocator keeps std container nodes in the pool")
+{
+    std::list< int, stct::StaticPoolAllocator< int, 8 > > list;
+    for (int i = 0; i < 8; ++i)
+    {
+        list.push_back(i);
+    }
+    REQUIRE_THROWS_AS(list.push_back(8), std::bad_alloc);
+    list.pop_front();
+    list.push_back(8);
+    REQUIRE(list.front() == 1);
+    REQUIRE(list.back() == 8);
+}
+
+TEST_CASE("static pool allocator serves node and bucket allocations")
+{
+    using Entry = std::pair< const int, std::string >;
+    std::map< int, std::string, std::less< int >, stct::StaticPoolAllocator< Entry, 16 > > map;
+    std::unordered_map< int,
+     std::string,
+     std::hash< int >,
+     std::equal_to< int >,
+     stct::StaticPoolAllocator< Entry, 16 > >
+     hashed;
+    for (int i = 0; i < 16; ++i)
+    {
+        map.emplace(i, std::to_string(i));
+        hashed.emplace(i, std::to_string(i));
+    }
+    REQUIRE(map.at(15) == "15");
+    REQUIRE(hashed.at(15) == "15");
+    REQUIRE_THROWS_AS(map.emplace(16, ""), std::bad_alloc);
+    REQUIRE(map.size() == 16);
+}
@@ -0,0 +1,140 @@
+#include "static_string.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "map.hpp"
+
+namespace stct = static_containers;
+
+TEST_CASE("static string is built at compile time")
+{
+    constexpr stct::StaticString< 8 > hello = "hello";
+    STATIC_REQUIRE(hello.size() == 5);
+    STATIC_REQUIRE(hello == "hello");
+    STATIC_REQUIRE(hello != "help");
+    STATIC_REQUIRE(hello < "help");
+    STATIC_REQUIRE(hello.view() == std::string_view("hello"));
+
+    constexpr stct::BasicStaticString deduced = "exact";
+    STATIC_REQUIRE(deduced.capacity() == 5);
+
+    constexpr stct::StaticU8String< 5 > utf8 = u8"été";
+    STATIC_REQUIRE(utf8.size() == 5);
+    REQUIRE(std::string_view(hello.c_str()) == "hello");
+}
+
+TEST_CASE("static string edits keep it terminated")
+{
+    stct::StaticString< 20 > str;
+    REQUIRE(str.empty());
+    str += "static";
+    str += '_';
+    str.append("string");
+    REQUIRE(str == "static_string");
+    REQUIRE(str.c_str()[str.size()] == '\0');
+
+    str.pop_back();
+    str.resize(6);
+    REQUIRE(str == "static");
+    REQUIRE(std::string_view(str.c_str()) == "static");
+
+    str.resize(8, '!');
+    REQUIRE(str == "static!!");
+    str.clear();
+    REQUIRE(str == "");
+
+    REQUIRE_THROWS_AS(str.assign(std::string(21, 'x')), std::length_error);
+    REQUIRE_THROWS_AS(stct::StaticString< 2 >(std::string_view("abc")), std::length_error);
+}
+
+TEST_CASE("static string assigns a view of itself")
+{
+    stct::StaticString< 20 > str = "static_string";
+    str.assign(str.view().substr(1));
+    REQUIRE(str == "tatic_string");
+    REQUIRE(str == stct::StaticString< 20 >("tatic_string"));
+    REQUIRE(str.c_str()[str.size()] == '\0');
+
+    str.assign(str.view().substr(0, 5));
+    REQUIRE(str == stct::StaticString< 20 >("tatic"));
+}
+
+TEST_CASE("static string takes an array up to its first null")
+{
+    char buf[16] = "ab";
+    stct::StaticString< 16 > str = buf;
+    REQUIRE(str.size() == 2);
+    REQUIRE(str == "ab");
+    REQUIRE(str == buf);
+    char later[8] = "ac";
+    REQUIRE(str < later);
+
+    stct::BasicStaticString deduced = buf;
+    STATIC_REQUIRE(decltype(deduced)::capacity() == 15);
+    REQUIRE(deduced.size() == 2);
+
+    const char full[3] = { 'a', 'b', 'c' };
+    REQUIRE(stct::StaticString< 2 >(full) == "ab");
+}
+
+TEST_CASE("static string compares by size then content")
+{
+    stct::StaticString< 40 > lhs(std::string_view("a rather long key, past one chunk"));
+    stct::StaticString< 40 > rhs = lhs;
+    REQUIRE(lhs == rhs);
+    rhs[30] = 'X';
+    REQUIRE(lhs != rhs);
+    REQUIRE(lhs > rhs);
+
+    rhs = lhs;
+    rhs.pop_back();
+    REQUIRE(lhs != rhs);
+    rhs.push_back('k');
+    REQUIRE(lhs == rhs);
+
+    stct::StaticString< 8 > shorter = "a";
+    REQUIRE(shorter < lhs.view());
+    REQUIRE(lhs == std::string("a rather long key, past one chunk"));
+}
+
+TEST_CASE("static string hashes as its view")
+{
+    stct::StaticString< 16 > key = "key";
+    REQUIRE(std::hash< stct::StaticString< 16 > >{}(key) ==
+            std::hash< std::string_view >{}("key"));
+}
+
+TEST_CASE("static string map keys")
+{
+    int hit = 0;
+    auto map = stct::make_map< stct::StaticString< 8 > >(
+     stct::Tuple{ stct::StaticString< 8 >("alpha"),
+         [&]()
+         {
+             hit = 1;
+         } },
+     stct::Tuple{ stct::StaticString< 8 >("beta"),
+         [&]()
+         {
+             hit = 2;
+         } });
+    map.visit_at("alpha",
+     [](auto & f)
+     {
+         f();
+     });
+    REQUIRE(hit == 1);
+    map.visit_at("beta",
+     [](auto & f)
+     {
+         f();
+     });
+    REQUIRE(hit == 2);
+}
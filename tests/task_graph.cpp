@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "task_graph.hpp"
+
+namespace stct = static_containers;
+
+namespace
+{
+    /// Diamond with stages declared out of order: 3 joins 0 and 2, both of which need 1
+    auto make_diamond(std::atomic< int > & calls)
+    {
+        return stct::make_task_graph(
+         stct::stage< 1 >(
+          [&](int source)
+          {
+              ++calls;
+              return source * 2;
+          }),
+         stct::stage<>(
+          [&]()
+          {
+              ++calls;
+              return 21;
+          }),
+         stct::stage< 1 >(
+          [&](int source)
+          {
+              ++calls;
+              return std::to_string(source);
+          }),
+         stct::stage< 0, 2 >(
+          [&](int doubled, const std::string & text)
+          {
+              ++calls;
+              return text + ":" + std::to_string(doubled);
+          }));
+    }
+}
+
+TEST_CASE("task graph schedule")
+{
+    std::atomic< int > calls = 0;
+    using Graph = decltype(make_diamond(calls));
+    static_assert(Graph::size() == 4);
+    static_assert(Graph::levels() == 3);
+    static_assert(Graph::level(0).size() == 1 && Graph::level(0)[0] == 1);
+    static_assert(Graph::level(1).size() == 2 && Graph::level(1)[0] == 0 &&
+                  Graph::level(1)[1] == 2);
+    static_assert(Graph::level(2).size() == 1 && Graph::level(2)[0] == 3);
+}
+
+TEST_CASE("task graph passes results along edges")
+{
+    std::atomic< int > calls = 0;
+    auto graph = make_diamond(calls);
+    auto results = graph.run();
+    REQUIRE(calls == 4);
+    REQUIRE(get< 0 >(results) == 42);
+    REQUIRE(get< 1 >(results) == 21);
+    REQUIRE(get< 2 >(results) == "21");
+    REQUIRE(get< 3 >(results) == "21:42");
+
+    results = graph.run();
+    REQUIRE(calls == 8);
+    REQUIRE(get< 3 >(results) == "21:42");
+}
+
+TEST_CASE("task graph fan out of stages returning nothing")
+{
+    std::vector< int > outputs(8);
+    auto fill = [&](size_t i)
+    {
+        return [&outputs, i](const int & seed)
+        {
+            outputs[i] = seed + static_cast< int >(i);
+        };
+    };
+    auto graph = stct::make_task_graph(stct::stage<>(
+                                        []()
+                                        {
+                                            return 100;
+                                        }),
+     stct::stage< 0 >(fill(0)), stct::stage< 0 >(fill(1)), stct::stage< 0 >(fill(2)),
+     stct::stage< 0 >(fill(3)), stct::stage< 0 >(fill(4)), stct::stage< 0 >(fill(5)),
+     stct::stage< 0 >(fill(6)), stct::stage< 0 >(fill(7)));
+    static_assert(decltype(graph)::levels() == 2);
+    static_assert(decltype(graph)::level(1).size() == 8);
+
+    auto results = graph.run();
+    REQUIRE(get< 1 >(results) == stct::StageDone{});
+    REQUIRE(outputs == std::vector{ 100, 101, 102, 103, 104, 105, 106, 107 });
+}
+
+TEST_CASE("task graph stops at the level which threw")
+{
+    bool reached = false;
+    auto graph = stct::make_task_graph(stct::stage<>(
+                                        []() -> int
+                                        {
+                                            throw std::runtime_error("stage failed");
+                                        }),
+     stct::stage< 0 >(
+      [&](int)
+      {
+          reached = true;
+      }));
+    REQUIRE_THROWS_AS(graph.run(), std::runtime_error);
+    REQUIRE_FALSE(reached);
+}
@@ -2,6 +2,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <cstddef>
+#include <type_traits>
 
 #include "comparators.hpp"
 
@@ -25,3 +26,43 @@ TEST_CASE("sorted pack")
         REQUIRE(packed::is_sorted< cmp::size_of::less >());
     }
 }
+
+TEST_CASE("ith type first")
+{
+    REQUIRE(std::is_same_v< stct::ith< 0, char, int >::type, char >);
+    REQUIRE(std::is_same_v< stct::pack< char, int >::type_at< 1 >, int >);
+}
+
+namespace
+{
+    /// Not keyed: sorting falls back to a pairwise table
+    struct SizeGreater
+    {
+        template < typename T1, typename T2 >
+        constexpr static bool value() noexcept
+        {
+            return sizeof(T1) > sizeof(T2);
+        }
+    };
+}
+
+TEST_CASE("sort pack")
+{
+    namespace cmp = stct::comparators;
+    using packed = stct::pack< size_t, int, double, char, float >;
+    {
+        using sorted = packed::sorted< cmp::size_of::less >;
+        REQUIRE(sorted::is_sorted< cmp::size_of::less >());
+        REQUIRE(std::is_same_v< sorted, stct::pack< char, int, float, size_t, double > >);
+    }
+    {
+        using sorted = packed::sorted< SizeGreater >;
+        REQUIRE(sorted::is_sorted< SizeGreater >());
+        REQUIRE(!packed::is_sorted< SizeGreater >());
+        REQUIRE(std::is_same_v< sorted, stct::pack< size_t, double, int, float, char > >);
+    }
+    {
+        using sorted = stct::pack<>::sorted< cmp::size_of::less >;
+        REQUIRE(std::is_same_v< sorted, stct::pack<> >);
+    }
+}
@@ -30,3 +30,35 @@ TEST_CASE("tuple tie")
     REQUIRE(b == 1);
     REQUIRE(c == 2);
 };
+
+TEST_CASE("tuple comparison")
+{
+    auto lhs = stct::Tuple{ int{ 0 }, size_t{ 1 }, char{ 2 } };
+    auto rhs = stct::Tuple{ int{ 0 }, size_t{ 2 }, char{ 0 } };
+    REQUIRE(lhs == lhs);
+    REQUIRE(lhs != rhs);
+    REQUIRE(lhs < rhs);
+};
+
+namespace
+{
+    struct Empty
+    {
+        auto operator<=>(const Empty &) const noexcept = default;
+    };
+
+    struct OtherEmpty
+    {
+        auto operator<=>(const OtherEmpty &) const noexcept = default;
+    };
+}
+
+TEST_CASE("tuple empty elements")
+{
+    static_assert(sizeof(stct::Tuple< Empty, OtherEmpty >) == 1);
+    static_assert(sizeof(stct::Tuple< Empty, int, OtherEmpty >) == sizeof(int));
+
+    auto tuple = stct::Tuple{ Empty{}, int{ 1 }, Empty{} };
+    REQUIRE(&tuple.at< 0 >() != &tuple.at< 2 >());
+    REQUIRE(tuple.at< 1 >() == 1);
+};
@@ -1,6 +1,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
+#include "drop_logger.hpp"
 #include "tuple_utils.hpp"
 
 namespace stct = static_containers;
@@ -38,4 +42,96 @@ TEST_CASE("tuple concat")
     auto tuple2 = stct::Tuple{ int{ 1 } };
     auto result = stct::concat(tuple1, tuple2);
     REQUIRE(result == stct::Tuple{ int{ 1 }, size_t{ 2 }, int{ 1 } });
-}
\ No newline at end of file
+}
+
+TEST_CASE("tuple concat moves from rvalues")
+{
+    using stct::testing::CopyMoveLog;
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    CopyMoveLog log;
+    {
+        auto tuple1 = stct::Tuple{ DropLogger{ destructed, log }, int{ 1 } };
+        auto tuple2 = stct::Tuple{ DropLogger{ destructed, log } };
+        log = {};
+
+        auto result = stct::concat(std::move(tuple1), std::move(tuple2));
+        REQUIRE(log.copies == 0);
+        REQUIRE(log.moves == 2);
+        REQUIRE(result.size() == 3);
+    }
+    REQUIRE(destructed == 2);
+}
+
+TEST_CASE("tuple concat copies lvalues once")
+{
+    using stct::testing::CopyMoveLog;
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    CopyMoveLog log;
+    {
+        auto tuple1 = stct::Tuple{ DropLogger{ destructed, log }, int{ 1 } };
+        const auto tuple2 = stct::Tuple{ DropLogger{ destructed, log } };
+        log = {};
+
+        auto result = stct::concat(tuple1, tuple2);
+        REQUIRE(log.copies == 2);
+        REQUIRE(log.moves == 0);
+    }
+    REQUIRE(destructed == 4);
+}
+
+TEST_CASE("tuple concat move-only")
+{
+    auto tuple1 = stct::Tuple{ std::make_unique< int >(1) };
+    auto tuple2 = stct::Tuple{ int{ 2 }, std::make_unique< int >(3) };
+    auto result = stct::concat(std::move(tuple1), std::move(tuple2));
+    REQUIRE(*get< 0 >(result) == 1);
+    REQUIRE(get< 1 >(result) == 2);
+    REQUIRE(*get< 2 >(result) == 3);
+    REQUIRE(get< 0 >(tuple1) == nullptr);
+}
+
+TEST_CASE("tuple concat refs")
+{
+    using stct::testing::CopyMoveLog;
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    CopyMoveLog log;
+    auto tuple1 = stct::Tuple{ DropLogger{ destructed, log }, int{ 1 } };
+    const auto tuple2 = stct::Tuple{ size_t{ 2 } };
+    log = {};
+
+    auto refs = stct::concat_refs(tuple1, tuple2);
+    static_assert(std::is_same_v< decltype(refs),
+     stct::Tuple< DropLogger &, int &, const size_t & > >);
+    REQUIRE(log.copies == 0);
+    REQUIRE(log.moves == 0);
+    REQUIRE(&get< 0 >(refs) == &get< 0 >(tuple1));
+    get< 1 >(refs) = 3;
+    REQUIRE(get< 1 >(tuple1) == 3);
+    REQUIRE(&get< 2 >(refs) == &get< 0 >(tuple2));
+}
+
+TEST_CASE("tuple forward as tuple")
+{
+    using stct::testing::CopyMoveLog;
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    CopyMoveLog log;
+    DropLogger lvalue{ destructed, log };
+    DropLogger rvalue{ destructed, log };
+
+    auto forwarded = stct::forward_as_tuple(lvalue, std::move(rvalue));
+    static_assert(
+     std::is_same_v< decltype(forwarded), stct::Tuple< DropLogger &, DropLogger && > >);
+    auto is_same_object = stct::unwrap_then_do(
+     [&](DropLogger & lhs, DropLogger && rhs)
+     {
+         return &lhs == &lvalue && &rhs == &rvalue;
+     },
+     std::move(forwarded));
+    REQUIRE(is_same_object);
+    REQUIRE(log.copies == 0);
+    REQUIRE(log.moves == 0);
+}
@@ -2,8 +2,10 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include <catch2/catch_test_macros.hpp>
@@ -94,4 +96,221 @@ TEST_CASE("variant destructs")
         stct::Variant< DropLogger, bool > to_destroy{ DropLogger{ destructed } };
     }
     assert(destructed == 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("visit several variants")
+{
+    stct::Variant< int, bool, char > lhs = char{ 'a' };
+    const stct::Variant< bool, int > rhs = int{ 7 };
+    auto result = stct::visit(
+     [](auto & l, auto & r)
+     {
+         static_assert(std::is_const_v< std::remove_reference_t< decltype(r) > >);
+         if constexpr (std::is_same_v< decltype(l), char & > &&
+                       std::is_same_v< decltype(r), const int & >)
+         {
+             return l + r;
+         }
+         else
+         {
+             return -1;
+         }
+     },
+     lhs, rhs);
+    REQUIRE(result == 'a' + 7);
+}
+
+TEST_CASE("visit unifies return types")
+{
+    const stct::Variant< int, double > var = double{ 0.5 };
+    auto result = stct::visit(
+     [](const auto & val)
+     {
+         return val;
+     },
+     var);
+    static_assert(std::is_same_v< decltype(result), double >);
+    REQUIRE(result == 0.5);
+}
+
+namespace
+{
+    struct Handle
+    {
+        unsigned short id;
+    };
+}
+
+TEST_CASE("variant of trivial alternatives is trivial")
+{
+    using VarT = stct::Variant< int, float, Handle >;
+    static_assert(std::is_trivially_copyable_v< VarT >);
+    static_assert(std::is_trivially_destructible_v< VarT >);
+    static_assert(sizeof(VarT) == 2 * sizeof(int));
+
+    VarT var = Handle{ 7 };
+    VarT copy;
+    std::memcpy(&copy, &var, sizeof(VarT));
+    REQUIRE(copy.at_t< Handle >().id == 7);
+}
+
+TEST_CASE("variant copies and moves the active alternative")
+{
+    using VarT = stct::Variant< int, std::string >;
+    static_assert(!std::is_trivially_copyable_v< VarT >);
+
+    VarT var = std::string(64, 'a');
+    VarT copy = var;
+    REQUIRE(copy.at_t< std::string >() == std::string(64, 'a'));
+    copy.at_t< std::string >()[0] = 'b';
+    REQUIRE(var.at_t< std::string >() == std::string(64, 'a'));
+
+    VarT moved = std::move(copy);
+    REQUIRE(moved.at_t< std::string >()[0] == 'b');
+
+    moved = VarT{ 5 };
+    REQUIRE(moved.at< 0 >() == 5);
+    moved = var;
+    REQUIRE(moved.at_t< std::string >() == std::string(64, 'a'));
+}
+
+TEST_CASE("variant destroys what it replaces")
+{
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    {
+        stct::Variant< DropLogger, bool > var{ DropLogger{ destructed } };
+        auto copy = var;
+        REQUIRE(destructed == 0);
+        copy = true;
+        REQUIRE(destructed == 1);
+        copy = var;
+        REQUIRE(destructed == 1);
+        var = copy;
+        REQUIRE(destructed == 1);
+    }
+    REQUIRE(destructed == 3);
+}
+
+TEST_CASE("variant emplaces in place unless construction may throw")
+{
+    using stct::testing::CopyMoveLog;
+    using stct::testing::DropLogger;
+
+    struct NothrowDropLogger : DropLogger
+    {
+        NothrowDropLogger(size_t & cnt, CopyMoveLog & log) noexcept:
+          DropLogger(cnt, log)
+        {}
+    };
+
+    size_t destructed = 0;
+    CopyMoveLog log;
+    {
+        stct::Variant< bool, DropLogger, NothrowDropLogger > var(
+         std::in_place_type< DropLogger >, destructed, log);
+        REQUIRE(var.holds< DropLogger >());
+
+        var.emplace< 0 >(true);
+        REQUIRE(destructed == 1);
+        REQUIRE(var.at< 0 >());
+
+        var.emplace< NothrowDropLogger >(destructed, log);
+        REQUIRE(log.moves == 0);
+
+        // DropLogger may throw, so it is constructed aside and moved in
+        var.emplace< DropLogger >(destructed, log);
+        REQUIRE(destructed == 2);
+        REQUIRE(log.moves == 1);
+
+        DropLogger other(destructed, log);
+        var = other;
+        var = std::move(other);
+        REQUIRE(destructed == 2);
+    }
+    REQUIRE(log.copies == 1);
+    REQUIRE(log.moves == 2);
+    REQUIRE(destructed == 3);
+}
+
+TEST_CASE("variant assignment switches alternatives")
+{
+    using stct::testing::CopyMoveLog;
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    CopyMoveLog log;
+    {
+        stct::Variant< int, DropLogger > var = 1;
+        DropLogger logger(destructed, log);
+        var = logger;
+        REQUIRE(var.holds< DropLogger >());
+        var = 2;
+        REQUIRE(destructed == 1);
+        REQUIRE(var.at< 0 >() == 2);
+        var = std::move(logger);
+    }
+    // copying and moving DropLogger may throw, so each switch to it goes through a temporary
+    REQUIRE(log.copies == 1);
+    REQUIRE(log.moves == 3);
+    REQUIRE(destructed == 2);
+}
+
+TEST_CASE("variant keeps its value if emplace throws")
+{
+    struct Throwing
+    {
+        explicit Throwing(bool fail)
+        {
+            if (fail)
+            {
+                throw std::runtime_error("construction failed");
+            }
+        }
+    };
+
+    stct::Variant< int, Throwing > var = 5;
+    REQUIRE_THROWS_AS(var.emplace< Throwing >(true), std::runtime_error);
+    REQUIRE(var.at< 0 >() == 5);
+    var.emplace< 1 >(false);
+    REQUIRE(var.index() == 1);
+}
+
+TEST_CASE("variant keeps its value if assignment of another alternative throws")
+{
+    using stct::testing::DropLogger;
+
+    struct ThrowingMove
+    {
+        explicit ThrowingMove(bool fail):
+          fail(fail)
+        {}
+
+        ThrowingMove(const ThrowingMove &) = default;
+
+        ThrowingMove(ThrowingMove && rhs):
+          fail(rhs.fail)
+        {
+            if (fail)
+            {
+                throw std::runtime_error("move failed");
+            }
+        }
+
+        ThrowingMove & operator=(const ThrowingMove &) = default;
+        ThrowingMove & operator=(ThrowingMove &&) = default;
+
+        bool fail;
+    };
+
+    size_t destructed = 0;
+    {
+        stct::Variant< DropLogger, ThrowingMove > var{ DropLogger{ destructed } };
+        stct::Variant< DropLogger, ThrowingMove > other(std::in_place_type< ThrowingMove >, true);
+        REQUIRE_THROWS_AS(var = std::move(other), std::runtime_error);
+        REQUIRE(var.holds< DropLogger >());
+        REQUIRE_THROWS_AS(var = other, std::runtime_error);
+        REQUIRE(var.holds< DropLogger >());
+        REQUIRE(destructed == 0);
+    }
+    REQUIRE(destructed == 1);
+}
@@ -0,0 +1,127 @@
+#include "variant_vector.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "drop_logger.hpp"
+
+namespace stct = static_containers;
+
+TEST_CASE("variant vector keeps alternatives apart")
+{
+    stct::VariantVector< 8, int, std::string > vec;
+    auto one = vec.push_back(1);
+    auto text = vec.push_back(std::string("text"));
+    auto two = vec.emplace< int >(2);
+    REQUIRE(vec.size() == 3);
+    REQUIRE(vec.segment< int >().size() == 2);
+    REQUIRE(vec.segment< std::string >().size() == 1);
+
+    REQUIRE(*vec.find< int >(one) == 1);
+    REQUIRE(*vec.find< int >(two) == 2);
+    REQUIRE(*vec.find< std::string >(text) == "text");
+    REQUIRE(vec.find< std::string >(one) == nullptr);
+
+    std::vector< std::string > visited;
+    vec.for_each(
+     [&](const auto & element)
+     {
+         if constexpr (std::is_same_v< std::remove_cvref_t< decltype(element) >, int >)
+         {
+             visited.push_back(std::to_string(element));
+         }
+         else
+         {
+             visited.push_back(element);
+         }
+     });
+    REQUIRE(visited == std::vector< std::string >{ "1", "2", "text" });
+}
+
+TEST_CASE("variant vector handles survive erasure of others")
+{
+    stct::VariantVector< 4, int, double > vec;
+    auto first = vec.push_back(1);
+    auto second = vec.push_back(2);
+    auto third = vec.push_back(3);
+
+    REQUIRE(vec.erase(first));
+    REQUIRE_FALSE(vec.erase(first));
+    REQUIRE_FALSE(vec.contains(first));
+    REQUIRE(*vec.find< int >(second) == 2);
+    REQUIRE(*vec.find< int >(third) == 3);
+
+    auto reused = vec.push_back(4);
+    REQUIRE(reused.slot == first.slot);
+    REQUIRE(vec.find< int >(first) == nullptr);
+    REQUIRE(*vec.find< int >(reused) == 4);
+
+    int sum = 0;
+    REQUIRE(vec.visit(third,
+     [&](auto value)
+     {
+         sum += static_cast< int >(value);
+     }));
+    REQUIRE(sum == 3);
+
+    vec.clear();
+    REQUIRE(vec.empty());
+    REQUIRE_FALSE(vec.contains(second));
+}
+
+TEST_CASE("variant vector finds nothing behind a handle of another type")
+{
+    stct::VariantVector< 4, int, double > vec;
+    auto handle = vec.push_back(1.5);
+    handle.type = 2;
+    REQUIRE_FALSE(vec.contains(handle));
+    REQUIRE_FALSE(vec.visit(handle, [](auto) {}));
+    REQUIRE_FALSE(vec.erase(handle));
+    REQUIRE(vec.find< double >(handle) == nullptr);
+    REQUIRE(vec.size() == 1);
+}
+
+TEST_CASE("ordered variant vector iterates in insertion order")
+{
+    stct::OrderedVariantVector< 8, int, char > vec;
+    vec.push_back(1);
+    auto a = vec.push_back('a');
+    vec.push_back(2);
+    vec.push_back('b');
+    auto three = vec.push_back(3);
+    vec.push_back('c');
+    vec.erase(a);
+    vec.erase(three);
+
+    std::string order;
+    vec.for_each_ordered(
+     [&](auto element)
+     {
+         if constexpr (std::is_same_v< decltype(element), int >)
+         {
+             order += static_cast< char >('0' + element);
+         }
+         else
+         {
+             order += element;
+         }
+     });
+    REQUIRE(order == "12bc");
+}
+
+TEST_CASE("variant vector destroys its elements")
+{
+    using stct::testing::DropLogger;
+    size_t destructed = 0;
+    {
+        stct::VariantVector< 4, DropLogger, int > vec;
+        vec.emplace< DropLogger >(destructed);
+        auto last = vec.emplace< DropLogger >(destructed);
+        vec.erase(last);
+        REQUIRE(destructed == 1);
+    }
+    REQUIRE(destructed == 2);
+}
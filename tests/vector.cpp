@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <functional>
 #include <ranges>
+#include <string>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
@@ -198,6 +199,29 @@ TEST_CASE("vector insert")
     }
 }
 
+TEST_CASE("vector insert and erase destroy every element once")
+{
+    using stct::testing::DropLogger;
+
+    size_t drops = 0;
+    {
+        stct::Vector< DropLogger, 8 > vec;
+        for (int i = 0; i < 4; ++i)
+        {
+            vec.emplace_back(drops);
+        }
+        vec.emplace(vec.begin() + 1, drops);
+        vec.insert(vec.begin(), 2, DropLogger(drops));
+        REQUIRE(drops == 1);
+        vec.erase(vec.begin() + 2);
+        REQUIRE(drops == 2);
+        vec.erase(vec.begin(), vec.begin() + 3);
+        REQUIRE(drops == 5);
+        REQUIRE(vec.size() == 3);
+    }
+    REQUIRE(drops == 8);
+}
+
 TEST_CASE("vector erase")
 {
     using VecT = stct::Vector< int, 100 >;
@@ -221,6 +245,10 @@ TEST_CASE("vector erase")
     {
         auto vec = stct::Vector< std::string, 20 >{ "dsaad", "aaaa", "auidisfou" };
         vec.erase(vec.begin());
+        REQUIRE(vec == stct::Vector< std::string, 20 >{ "aaaa", "auidisfou" });
+        vec.insert(vec.begin(), 2, "b");
+        vec.erase(vec.begin() + 1, vec.begin() + 3);
+        REQUIRE(vec == stct::Vector< std::string, 20 >{ "b", "auidisfou" });
     }
     SECTION("remove-erase")
     {